@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include "Uno9341TFT.h"
 #include "terminal_constants.h"
+#include "build_profile.h"
 #include "ansicodes.h"
 #include "myfont.h"
 
@@ -15,6 +16,64 @@
 //#define BAUDRATE (38400)
 #define BAUDRATE (57600)
 //#define BAUDRATE (115200)
+//#define BAUDRATE (250000)
+//#define BAUDRATE (500000)
+//#define BAUDRATE (1000000)
+
+// Largest baud rate error accepted, in tenths of a percent, when choosing
+// between normal and U2X (double speed) mode. The host can also request a 
+// faster rate at runtime (CSI ? 901 ; <baud/100> p); if it doesn't confirm 
+// with ENQ at the new rate within UART_SWITCH_TIMEOUT ms, we revert to BAUDRATE.
+// test_terminal/baudprobe.cpp has a copy of UART_SWITCH_TIMEOUT to match.
+#define UART_MAX_ERROR      (25)
+#define UART_SWITCH_TIMEOUT (500)
+
+// The cursor is drawn once no input has arrived for this many ms. Blinking
+// cursor styles are shown and hidden for CURSOR_BLINK ms each. 
+// CURSOR_DEFAULT is the style for DECSCUSR 0 (CSI 0 SP q): 1,2 block, 3,4 
+// underline, 5,6 bar, where odd styles blink. 
+#define CURSOR_DELAY   (20)
+#define CURSOR_BLINK   (500)
+#define CURSOR_DEFAULT (4)
+
+// Synchronized output ends by itself after this many ms, in case the host 
+// never sends CSI ? 2026 l
+#define SYNC_TIMEOUT (1000)
+
+// SRAM for the serial receive ring buffer and its bookkeeping (see uart.h).
+// The buffer holds 16-bit tokens (decoded characters), and gets the largest
+// power of two that fits, up to 128 tokens.
+#define UART_SRAM_BUDGET (256+18)
+// Flow control: send XOFF when this many received tokens are waiting, and XON
+// once the backlog has drained to this many. Leave room above the XOFF level 
+// for whatever the host (and its USB-serial adapter) sends before it pauses.
+#define UART_XOFF_LEVEL  (UART_RX_SIZE/2)
+#define UART_XON_LEVEL   (UART_RX_SIZE/8)
+
+// Optional features. These cost flash that a large font profile might not 
+// leave over; comment them out to make room.
+// Rectangular area operations: DECFRA, DECERA, DECCRA, DECCARA, DECRARA
+// (rectangles.h). These keep a reverse video flag per cell, 140 bytes of SRAM.
+#define RECTANGLE_OPS
+// Retained cell model: skip redrawing unchanged cells, and scroll without 
+// reading pixels back (cells.h). This takes about 700 bytes of SRAM, so set
+// UART_SRAM_BUDGET to (128+18) when enabling it. 
+//#define CELL_MODEL
+// Glyph word mode: after CSI ? 903 h, the host can send packed glyph words 
+// from the font tables instead of characters, skipping the unicode lookup
+// (parser.h; see test_terminal/glyphencode.cpp for an encoder)
+#define GLYPH_WORDS
+// Compressed input: after CSI ? 904 h the host can send LZ-compressed text 
+// (uart.h; see test_terminal/lzencode.cpp). Matches reach back up to 
+// LZ_WINDOW characters (a power of two, at most 256), which takes twice as 
+// many bytes of SRAM; set UART_SRAM_BUDGET to (128+18) when enabling it.
+//#define LZ_INPUT
+#define LZ_WINDOW (128)
+// Uploaded glyphs: the host can bind 12x6 bitmaps to codepoints the font 
+// doesn't have, with a DECDLD-style DCS (softglyphs.h). Each slot takes 16 
+// bytes of SRAM.
+//#define SOFT_GLYPHS
+#define SOFT_GLYPH_SLOTS (8)
 
 // Clip an integer to a range of values
 #define CLIP(x,lo,hi) (min(hi,max(lo,(x))))
@@ -29,10 +88,19 @@ Uno9341TFT tft;
 byte row = TR-1;
 byte col = 0;
 
+// Scrolling region (DECSTBM), as rows. Rows count up from the bottom, so the
+// top margin is the larger number. 
+byte margin_top    = TR-1;
+byte margin_bottom = 0;
+
 // Registers for stashing cursor state
 byte saved_row = TR-1;
 byte saved_col = 0;
 
+// Color pallet: 16 ANSI colors then the default foreground and background.
+// Loaded from default_color_cycle (colors.h) by reset().
+byte color_cycle[PALETTE_SIZE];
+
 // Color registers: foreground, background, underline
 byte fg = (byte)FG_DEFAULT;
 byte bg = (byte)BG_DEFAULT;
@@ -49,8 +117,21 @@ byte strike_mode    = NORMAL;
 byte frame_mode     = NORMAL;
 byte script_mode    = NORMAL;
 
-// Cursor drawing is very brittle, since we need to draw/erase with xor
+// The cursor is only drawn while input is idle; cursor_drawn is set while
+// it is on screen, at cursor_row, cursor_col, and cursor_under holds the 
+// pixels it covers (see draw_cursor()). 
 byte cursor_visible = 1;
+byte cursor_style   = CURSOR_DEFAULT;
+byte cursor_drawn   = 0;
+byte cursor_row     = 0;
+byte cursor_col     = 0;
+byte cursor_under[CH*CW];
+unsigned long last_input = 0;
+
+// Synchronized output (CSI ? 2026 h/l): while set, the cursor stays hidden
+// and the blink machine is paused. 
+byte sync_output = 0;
+unsigned long sync_start = 0;
 
 // Global buffer used for copying data
 byte copy_buffer[256];
@@ -67,14 +148,32 @@ byte new_combining_ok = 0;
 byte prev_row = 0;
 byte prev_col = 0;
 
+// The most recent graphic character, repeated by REP (CSI b). While
+// rep_loaded is set, char_bitmap still holds its styled glyph.
+uint32_t rep_code = 0;
+byte rep_loaded = 0;
+
+// The codepoint being drawn, for the cell model (cells.h). Set before 
+// drawing anything that can be drawn again from its codepoint alone. 
+uint32_t cell_code = 0;
+
+// Set while graphic characters from U+00A0 on are glyph words (CSI ? 903 h)
+byte glyph_words = 0;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Code organized into different header files. This is *slightly* abusing header
 // files. Please include these files here and ONLY here, in this order.
+#include "uart.h"
 #include "blinker.h"
 #include "textgraphics.h"
 #include "terminal_misc.h"
+#include "lookahead.h"
+#include "softglyphs.h"
 #include "fontmap.h"
 #include "control.h"
+#include "cells.h"
+#include "rectangles.h"
+#include "parser.h"
 
 ////////////////////////////////////////////////////////////////////////////////
 // setup and loop 
@@ -83,11 +182,12 @@ void setup(void)
 {
   tft.begin();
   reset();
-  Serial.begin(BAUDRATE);
+  uart_begin(BAUDRATE);
+  blink_timer_begin();
   
   /*
   // Test 1: just say hello over serial
-  Serial.println("Hello");
+  uart_print("Hello\r\n");
   
   // Test 2: check that basic graphics drivers work
   tft.fillScreen(RED);
@@ -106,8 +206,8 @@ void setup(void)
     advance_cursor(1);
   }
   unsigned long time1 = millis();
-  Serial.print("Time took was: ");
-  Serial.println(time1-time0);
+  uart_print("Time took was: ");
+  uart_write_uint(time1-time0);
   */
   
   // Test 4: does unicode mapping work? 
@@ -158,93 +258,13 @@ void setup(void)
 }
 
 void loop(void) {
-  while (Serial.available()) {
-    // Process next byte of input.
-    byte inByte = (byte)(Serial.read());
-    // If the input results in a caharacter that can 
-    // accept combining marks, this flag will be set. 
-    new_combining_ok = 0;
-    if (inByte<32) switch (inByte) {
-      case BELL: bell(); break;
-      case BACKSPACE: backspace(); break;  
-      case HORIZONTAL_TAB: {
-        byte colto = min(TC-1,(col+5)&0b11111100);
-        byte spaces = colto-col;
-        for (byte i=0; i<spaces; i++) print(" "); 
-        } break;     
-      case NEWLINE:       
-        cstamp(); 
-        newline(); 
-        cstamp(); 
-        break;
-      case VERTICAL_TAB:    
-        cstamp(); 
-        scroll(max(0,4-row)); 
-        row=max(0,row-4); 
-        cstamp(); 
-        break;
-      case FORM_FEED:       
-        cstamp(); 
-        scroll(max(0,1-row)); 
-        row=max(0,row-1); 
-        cstamp(); 
-        break;
-      case CARRIAGE_RETURN: 
-        cstamp(); 
-        col=0;     
-        cstamp();
-        break;
-      case DEVICE_CONTROL4:
-        // Non-standard code; Using this for screen capture; 
-        // Experimental! 
-        {
-          bell();
-          for (int y=0; y<320; y++) {
-            SET_XY_RANGE(0,239,y);
-            tft.readPixels(240, copy_buffer);
-            for (byte x=0; x<240; x++) { 
-              Serial.write(copy_buffer[240-1-x]);
-            }
-          }
-        }
-        break;
-      case ESCAPE: 
-        switch (blocking_read()) {
-          case '[': parse_CSI_sequence(); break; // CSI sequence
-          case '7': save_cursor();        break; // Save cursor            
-          case '8': restore_cursor();     break; // Restore cursor
-          case 'c': reset();              break; // Reset all state
-        }
-        break;
-    } else if (inByte<0x7E) {
-      // Fast-track ASCII TODO
-      if (parse_utf8(inByte)==FAIL) {
-        // We should know if something bad happened
-        prepare_cursor();
-        load_glyph_bitmap(REPLACEMENT_CHARACTER);
-        drawCharFancy(CH*row,CW*col,YELLOW,BLACK,NORMAL,NORMAL,HALFWIDTH);
-        advance_cursor(1);
-      }
-    } else if (inByte<0xA0) switch (inByte) {
-      // High control code? 
-      case DELETE: backspace();          break;
-      case CSI:    parse_CSI_sequence(); break;
-      
-      
-    } else if (inByte>=0b11000000) {
-      // UTF-8, Parse as unicode
-      if (parse_utf8(inByte)==FAIL) {
-        // We should know if something bad happened
-        prepare_cursor();
-        load_glyph_bitmap(REPLACEMENT_CHARACTER);
-        drawCharFancy(CH*row,CW*col,BLUE,BLACK,NORMAL,NORMAL,HALFWIDTH);
-        advance_cursor(1);
-      }
-    }
-    // Update whether the most recently drawn character should accept
-    // combining modifiers
-    combining_ok = new_combining_ok;
-  } 
+  // Process input as it arrives; partial sequences wait in the parser. 
+  // The cursor comes off first, and idle() puts it back when things go quiet.
+  if (uart_ready()) {
+    erase_cursor();
+    while (uart_ready()) parse_token(uart_read());
+    last_input = millis();
+  }
   idle();
 }
 
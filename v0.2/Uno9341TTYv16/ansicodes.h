@@ -116,8 +116,9 @@ Tricky to implement
 54 	Neither framed nor encircled 	
 */
 
-#define FG_DEFAULT ((uint8_t)WHITE)
-#define BG_DEFAULT ((uint8_t)BLACK)
+// Default colors can be changed with OSC 10/11 (see colors.h, control.h)
+#define FG_DEFAULT (color_cycle[PALETTE_FG])
+#define BG_DEFAULT (color_cycle[PALETTE_BG])
 
 #define NORMAL         (0)
 #define INVERT         (1)
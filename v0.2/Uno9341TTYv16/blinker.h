@@ -1,13 +1,24 @@
 #ifndef BLINKER_H
 #define BLINKER_H
 
+// Blink and bell timing comes from a Timer1 tick, so it doesn't depend on
+// how busy the main loop is.
+#define TIMER_TICK_HZ (100) // Timer interrupts per second
+#define BLINK_TICKS   (50)  // Ticks between blink phase changes
+#define BELL_TICKS    (15)  // Ticks the screen stays inverted for the bell
+volatile byte timer_ticks = 0;
+
 // To emulate the bell, we invert the screen for a time.
-volatile unsigned int bell_counter = 0;
+volatile byte bell_counter = 0;
+byte bell_on = 0;
 
 // Blink loop in the background
 // We store information needed for the blink code in a bit-vector
 // To avoid slowing down scrolling, we pad each row to a whole number of bytes
 // Blink flags are set in the advance_cursor function in terminal_misc.h
+// Bit r of blink_rows is set if row r might have blinking or highlighted
+// cells. The blink machine skips other rows, and clears the bit for rows
+// it finds empty.
 
 #define BLINK_BYTES_PER_ROW (TC/8+1)
 #define BLINK_BYTES         (TR*BLINK_BYTES_PER_ROW)
@@ -31,77 +42,130 @@ void BVEC_CLEAR(volatile byte *bitvector,byte row, byte column) {
 
 volatile byte blinking[BLINK_BYTES];
 volatile byte highlight[BLINK_BYTES];
-// Variables for the blink-rendering state machine
-#define BLINK_DELAY (15000)
-volatile unsigned long blink_counter=0;
-volatile unsigned int  blink_r=0;
-volatile unsigned int  blink_c=0;
-volatile byte blinkphase=0;
+#ifdef RECTANGLE_OPS
+// Cells drawn in reverse video, so that DECCARA can set or clear it
+// (rectangles.h). These are kept along with the blink flags.
+byte reversed[BLINK_BYTES];
+#endif
+#define BLINK_ROW(r) (1UL<<(r))
+uint32_t blink_rows = 0;
+// Variables for the blink-rendering state machine. After each phase change
+// blink_r walks the rows, one per call to idle(), until it reaches TR.
+byte blink_tick = 0;
+byte blink_r    = TR;
+byte blinkphase = 0;
+
+/** Timer tick, for blink and bell timing */
+ISR(TIMER1_COMPA_vect) {
+  timer_ticks++;
+  if (bell_counter) bell_counter--;
+}
 
+/** Start the timer tick: Timer1 in CTC mode, clock/256 */
+void blink_timer_begin() {
+  TCCR1A = 0;
+  TCCR1B = _BV(WGM12) | _BV(CS12);
+  OCR1A  = F_CPU/256/TIMER_TICK_HZ-1;
+  TIMSK1 = _BV(OCIE1A);
+}
 
+/** Clear the blink flags of cells start..end-1, counting cells row by row
+ *  from the bottom left. Whole bytes are cleared at once where possible.
+ */
 void mark_cleared_for_blink(unsigned int start_index_inclusive, unsigned int end_index_exclusive) {
   unsigned int i = start_index_inclusive;
-  // TODO OPTIMIZE THIS
-   while (i<end_index_exclusive) {
-     unsigned int c = i%TC;
-     unsigned int r = i/TC;
-     byte byte_index = r*BLINK_BYTES_PER_ROW + (c>>3);
-     byte bit_mask   = ~(1<<(c&0b111));
-     blinking [byte_index] &= bit_mask;
-     highlight[byte_index] &= bit_mask;
-     //BVEC_CLEAR(blinking,r,c);
-     //BVEC_CLEAR(highlight,r,c);
-     i++; 
-   }
-  /*
-  while (i<end_index_exclusive && (i&0b111)) {
-    BVEC_CLEAR(blinking,i);
-    BVEC_CLEAR(highlight,i);
-    i++;
-  }
-  byte j = i>>3;
-  while (i+8<end_index_exclusive) {
-    highlight[j] = blinking[j] = 0;
-    i+=8; 
-    j++;
-  }
   while (i<end_index_exclusive) {
-    BVEC_CLEAR(blinking,i);
-    BVEC_CLEAR(highlight,i);
-    i++;
-  }*/
+    byte r  = i/TC;
+    byte c  = i%TC;
+    // Clear to the end of this row, or to the end of the range
+    byte c1 = min(end_index_exclusive-(unsigned int)r*TC, TC);
+    byte j  = r*BLINK_BYTES_PER_ROW + (c>>3);
+    while (c<c1) {
+      byte n    = min(8-(c&0b111), c1-c);
+      byte mask = ~(((1<<n)-1)<<(c&0b111));
+      blinking [j] &= mask;
+      highlight[j] &= mask;
+      #ifdef RECTANGLE_OPS
+      reversed [j] &= mask;
+      #endif
+      c += n;
+      j++;
+    }
+    i = (unsigned int)r*TC+c1;
+  }
 }
 
 /** Reset blink state and blink machine state */
 void clear_blink() {
   for (int i=0; i<BLINK_BYTES; i++) highlight[i]=blinking[i]=0;
-  blink_r = blink_c = blink_counter = blinkphase = 0;
+  #ifdef RECTANGLE_OPS
+  memset(reversed,0,BLINK_BYTES);
+  #endif
+  blink_rows = 0;
+  blink_r    = TR;
+  blinkphase = 0;
 }
 
-/** Scroll the blink/highlight buffers */
-void scrollblink(int scroll_rows) {
+/** Scroll the blink/highlight buffers for rows lo..hi (inclusive). Positive
+ *  scroll_rows moves flags up (toward row hi). Rows scrolled in are cleared.
+ */
+void scrollblink(byte lo, byte hi, int scroll_rows) {
   if (scroll_rows==0) return; 
-  byte to,from,inc;
+  // Rows in the region may get flags from any other row in it
+  uint32_t region = BLINK_ROW(hi+1)-BLINK_ROW(lo);
+  if (blink_rows & region) blink_rows |= region;
+  byte first = lo*BLINK_BYTES_PER_ROW;
+  byte end   = (hi+1)*BLINK_BYTES_PER_ROW;
+  byte shift = min(abs(scroll_rows),hi-lo+1)*BLINK_BYTES_PER_ROW;
+  byte i;
   if (scroll_rows>0) { // Scroll up: 
-    to   = BLINK_BYTES-1;
-    from = to - scroll_rows*BLINK_BYTES_PER_ROW;
-    inc  = -1;
+    for (i=end-1; i>=first+shift; i--) {
+      blinking [i] = blinking [i-shift];
+      highlight[i] = highlight[i-shift];
+      #ifdef RECTANGLE_OPS
+      reversed [i] = reversed [i-shift];
+      #endif
+    }
+    for (i=first; i<first+shift; i++) highlight[i]=blinking[i]=0;
+    #ifdef RECTANGLE_OPS
+    memset(reversed+first,0,shift);
+    #endif
   }
   else { // Scroll down: 
-    scroll_rows = -scroll_rows;
-    to   = 0;
-    from = scroll_rows*BLINK_BYTES_PER_ROW;
-    inc  = 1;
-  }
-  for (byte i=scroll_rows; i<TR; i++) {
-    for (byte j=0; j<BLINK_BYTES_PER_ROW; j++) {
-      blinking [to] = blinking [from];
-      highlight[to] = highlight[from];
-      to+=inc; from+=inc;
+    for (i=first; i+shift<end; i++) {
+      blinking [i] = blinking [i+shift];
+      highlight[i] = highlight[i+shift];
+      #ifdef RECTANGLE_OPS
+      reversed [i] = reversed [i+shift];
+      #endif
     }
+    for (i=end-shift; i<end; i++) highlight[i]=blinking[i]=0;
+    #ifdef RECTANGLE_OPS
+    memset(reversed+end-shift,0,shift);
+    #endif
   }
 }
 
+/** Copy the blink/highlight flags of cell (fr,fc) to cell (r,c) */
+void copyblink(byte r, byte c, byte fr, byte fc) {
+  if (blink_rows & BLINK_ROW(fr)) blink_rows |= BLINK_ROW(r);
+  if (BVEC_GET(blinking, fr,fc)) BVEC_SET(blinking, r,c); else BVEC_CLEAR(blinking, r,c);
+  if (BVEC_GET(highlight,fr,fc)) BVEC_SET(highlight,r,c); else BVEC_CLEAR(highlight,r,c);
+  #ifdef RECTANGLE_OPS
+  if (BVEC_GET(reversed, fr,fc)) BVEC_SET(reversed, r,c); else BVEC_CLEAR(reversed, r,c);
+  #endif
+}
+
+/** Shift the blink/highlight flags of cells c..TC-1 on row r by n cells, 
+ *  right if n>0 (inserting) or left if n<0 (deleting). The caller clears the
+ *  cells left blank with mark_cleared_for_blink. 
+ */
+void shiftblink(byte r, byte c, int n) {
+  byte i;
+  if (n>0) for (i=TC-1; i>=c+n; i--) copyblink(r,i,r,i-n);
+  else     for (i=c; i<TC+n; i++)    copyblink(r,i,r,i-n);
+}
+
 /** Update the blink flag information. The "blink machine" needs this
  *  to render blinking text correctly
  */ 
@@ -110,42 +174,81 @@ inline void update_blink(byte r, byte c) {
   byte byte_index = r*BLINK_BYTES_PER_ROW + (c>>3);
   byte bit_mask   = ~(1<<(c&0b111));
   highlight[byte_index] &= bit_mask;
+  #ifdef RECTANGLE_OPS
+  if (invert==NORMAL) reversed[byte_index] &=  bit_mask;
+  else                reversed[byte_index] |= ~bit_mask;
+  #endif
   if (blink_mode==NORMAL) blinking[byte_index] &=  bit_mask;
-  else                    blinking[byte_index] |= ~bit_mask;
+  else {
+    blinking[byte_index] |= ~bit_mask;
+    blink_rows |= BLINK_ROW(r);
+  }
 }
 
 
 // This weirdness a consequence of our abuse of header files
 void invert_location(byte row, byte col);
+void end_sync();
+void update_cursor();
+void erase_cursor();
+void flush_cells();
+void flush_cells_if_due();
+
 
+/** Bring the highlight of row r up to date with the blink phase: blinking
+ *  cells are inverted in phase 0, and nothing is inverted in phase 1. 
+ *  Cells are compared a byte (8 cells) at a time. 
+ */
+void update_blink_row(byte r) {
+  byte j   = r*BLINK_BYTES_PER_ROW;
+  byte any = 0;
+  for (byte k=0; k<BLINK_BYTES_PER_ROW; k++, j++) {
+    byte target = blinkphase? 0 : blinking[j];
+    byte change = highlight[j]^target;
+    any |= blinking[j];
+    if (!change) continue;
+    for (byte b=0; b<8; b++) if (change & (1<<b)) {
+      byte c = k*8+b;
+      // The pixels saved under the cursor would be stale once we invert its cell
+      if (cursor_drawn && r==cursor_row && c==cursor_col) erase_cursor();
+      invert_location(r,c);
+    }
+    highlight[j] = target;
+  }
+  if (!any) blink_rows &= ~BLINK_ROW(r);
+}
 
 /** Run animation/blink routines in the background, while idle 
  */
 void idle() {
   // "Bell" implemented as full-screen blink
-  if (bell_counter>0) { bell_counter--; return; }
-  COMMAND(ILI9341_INVERTOFF);
+  if (bell_counter) return;
+  if (bell_on) {COMMAND(ILI9341_INVERTOFF); bell_on = 0;}
   
-  // "Blink machine"
-  if (blink_counter) {blink_counter--; return;}
-  blink_c++;
-  if (blink_c>=TC) {
-    // End of row. Continue to next row. 
-    blink_c=0; blink_r++;
-    // End of screen. Start again at beginning. Toggle the blink phase bit. 
-    if (blink_r>=TR) {blink_r=0; blinkphase^=1; blink_counter=BLINK_DELAY;}
+  // Hold everything still while the host draws a synchronized frame
+  if (sync_output) {
+    if (millis()-sync_start>SYNC_TIMEOUT) end_sync();
+    return;
   }
-  // Check if location is blinking, and whether it is highlighted
-  byte isblinking  = BVEC_GET(blinking ,blink_r,blink_c);
-  byte ishighlight = BVEC_GET(highlight,blink_r,blink_c);
-  // Change highlight to correct state 
-  if ((blinkphase || !isblinking) && ishighlight) {
-    invert_location(blink_r,blink_c); 
-    BVEC_CLEAR(highlight,blink_r,blink_c);
-  } else if (isblinking  && !blinkphase && !ishighlight) {
-    invert_location(blink_r,blink_c); 
-    BVEC_SET(highlight,blink_r,blink_c);
+  
+  // Once input has gone quiet, draw whatever the cell model has been 
+  // holding back, and put the cursor back
+  if (millis()-last_input>=CURSOR_DELAY) {
+    flush_cells();
+    update_cursor();
+  }
+  else flush_cells_if_due();
+  
+  // "Blink machine": change phase every BLINK_TICKS, then update the rows 
+  // that have blinking cells, one per call
+  byte now = timer_ticks;
+  if ((byte)(now-blink_tick)>=BLINK_TICKS) {
+    blink_tick = now;
+    blinkphase ^= 1;
+    blink_r = 0;
   }
+  while (blink_r<TR && !(blink_rows & BLINK_ROW(blink_r))) blink_r++;
+  if (blink_r<TR) update_blink_row(blink_r++);
 }
 
 
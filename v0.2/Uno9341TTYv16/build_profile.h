@@ -0,0 +1,12 @@
+#ifndef BUILD_PROFILE_H
+#define BUILD_PROFILE_H
+// This file is automatically generated, do not edit it,
+// see ./prepare_fonts/README.md for more information. 
+
+// Build profile (TTY_PROFILE, see build_profiles in CONFIG.py)
+#define BUILD_PROFILE "full"
+
+// Fast paths enabled with the flash this profile leaves over
+// (none)
+
+#endif // BUILD_PROFILE_H
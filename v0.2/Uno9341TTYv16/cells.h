@@ -0,0 +1,326 @@
+#ifndef CELLS_H
+#define CELLS_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Retained cell model (optional, see CELL_MODEL in the .ino)
+//
+// Without it, the only record of what is on screen is the pixels in GRAM.
+// With it, each cell also holds a 4-bit index into a table of entries, each
+// a codepoint and a set of attributes (the SGR registers), so we know what
+// the cell shows and can draw it again. Index 0 means we don't know. A byte
+// per cell won't fit next to the receive buffer, copy_buffer and the blink
+// flags in 2K of SRAM, so there are only 15 entries and CELL_ATTRS sets of
+// attributes. Entries are reference counted, and are only reused once no
+// cell refers to them. Anything that doesn't fit (a 16th distinct character
+// on screen, codepoints past U+FFFF, combined characters, full-width glyphs,
+// rectangle copies...) is left unknown, and handled as before. This pays
+// off on screens with few distinct characters, like progress bars, status
+// lines and columns of numbers. Scrolling varied text soon fills the table,
+// and then costs the same as without the model.
+//
+// The model is used to:
+//   - skip drawing a character over an identical one, as when a progress
+//     bar or status line is rewritten
+//   - scroll without reading pixels back, if every cell being moved is
+//     known. The moved rows are marked damaged, and flush_cells() redraws
+//     them from the model: when input goes idle, or after CELL_FLUSH_TICKS
+//     under a backlog. Rows that scroll again before then cost nothing, and
+//     characters written to a damaged row only update the model.
+//   - draw runs of blank cells with a single fillRect when flushing
+//
+// Skipping or deferring a character leaves char_bitmap holding something
+// else, so it is only done when the next token waiting in the receive
+// buffer is ASCII, which can't combine with it, and when the character is
+// below U+0300, so can't be a combining mark itself. Without a backlog
+// there's time to draw everything anyway.
+//
+// Rows are stored as lines of cells[], and cell_line maps each row to its
+// line, so scrolling the model only permutes cell_line.
+
+#ifdef CELL_MODEL
+
+#define CELL_ENTRIES       (16) // Entry 0 stands for "unknown"
+#define CELL_ATTRS         (4)  // Distinct sets of attributes
+#define CELL_BYTES_PER_ROW ((TC+1)/2)
+#define CELL_FLUSH_TICKS   (5)  // Timer ticks damage may wait under a backlog
+
+byte     cells[TR*CELL_BYTES_PER_ROW];
+byte     cell_line[TR];
+uint16_t cell_codes[CELL_ENTRIES];
+byte     cell_attr [CELL_ENTRIES]; // Index into cell_attrs
+uint16_t cell_refs [CELL_ENTRIES]; // Number of cells using each entry
+byte     cell_attrs[CELL_ATTRS][SGR_REGISTERS];
+byte     cell_attr_refs[CELL_ATTRS]; // Number of entries in use with each
+uint32_t cells_damaged = 0; // Bit r is set if row r needs drawing again
+byte     cells_damage_tick = 0;
+
+/** Get the entry index for row r, column c */
+byte cell_get(byte r, byte c) {
+  byte v = cells[cell_line[r]*CELL_BYTES_PER_ROW+(c>>1)];
+  return c&1? v>>4 : v&0x0F;
+}
+
+/** Set the entry index for row r, column c, keeping reference counts */
+void cell_put(byte r, byte c, byte i) {
+  byte *p = cells + cell_line[r]*CELL_BYTES_PER_ROW + (c>>1);
+  byte old = c&1? *p>>4 : *p&0x0F;
+  if (old==i) return;
+  if (old && !--cell_refs[old]) cell_attr_refs[cell_attr[old]]--;
+  if (i && !cell_refs[i]++) cell_attr_refs[cell_attr[i]]++;
+  *p = c&1? (*p&0x0F)|(i<<4) : (*p&0xF0)|i;
+}
+
+/** Copy the SGR registers into attrs */
+void cells_get_attributes(byte *attrs) {
+  for (byte i=0; i<SGR_REGISTERS; i++)
+    attrs[i] = *(byte*)pgm_read_ptr(&sgr_registers[i]);
+}
+
+/** Load the SGR registers from attrs */
+void cells_set_attributes(const byte *attrs) {
+  for (byte i=0; i<SGR_REGISTERS; i++)
+    *(byte*)pgm_read_ptr(&sgr_registers[i]) = attrs[i];
+}
+
+/** Find the entry for a codepoint drawn with the given attributes, taking
+ *  over an unused entry if there isn't one yet. Returns 0 if there's no
+ *  room. The entry isn't in use until a cell is set to it with cell_put().
+ */
+byte cells_entry(uint32_t code, const byte *attrs) {
+  if (!code || code>0xFFFF) return 0;
+  byte a, free_a = CELL_ATTRS;
+  for (a=0; a<CELL_ATTRS; a++) {
+    if (!memcmp(cell_attrs[a],attrs,SGR_REGISTERS)) break;
+    if (!cell_attr_refs[a]) free_a = a;
+  }
+  if (a==CELL_ATTRS) {
+    if (free_a==CELL_ATTRS) return 0;
+    a = free_a;
+    memcpy(cell_attrs[a],attrs,SGR_REGISTERS);
+  }
+  // Unused entries keep their contents, and can be taken back as they are
+  byte i, free_i = 0;
+  for (i=1; i<CELL_ENTRIES; i++) {
+    if (cell_codes[i]==code && cell_attr[i]==a) return i;
+    if (!cell_refs[i]) free_i = i;
+  }
+  if (free_i) {
+    cell_codes[free_i] = code;
+    cell_attr [free_i] = a;
+  }
+  return free_i;
+}
+
+/** Entry for a blank cell, as left by clearing with the current background */
+byte cells_blank_entry() {
+  byte attrs[SGR_REGISTERS];
+  memset(attrs,NORMAL,SGR_REGISTERS);
+  attrs[SGR_FG] = attrs[SGR_BG] = attrs[SGR_UL] = bg;
+  return cells_entry(' ',attrs);
+}
+
+/** If entry i is a space with nothing drawn over it, return 1 and put its
+ *  color in *color
+ */
+byte cells_is_blank(byte i, byte *color) {
+  if (cell_codes[i]!=' ') return 0;
+  const byte *attrs = cell_attrs[cell_attr[i]];
+  if (attrs[SGR_INVERT] || attrs[SGR_FONT] || attrs[SGR_BLINK] ||
+      attrs[SGR_UNDERLINE] || attrs[SGR_OVERLINE] || attrs[SGR_STRIKE])
+    return 0;
+  *color = attrs[SGR_BG];
+  return 1;
+}
+
+/** Draw row r from the model. Unknown cells are left alone: they are only
+ *  found in a damaged row if they were drawn after it was damaged.
+ */
+void cells_draw_row(byte r) {
+  byte c = 0;
+  while (c<TC) {
+    byte i = cell_get(r,c), color;
+    if (!i) {c++; continue;}
+    if (cells_is_blank(i,&color)) {
+      byte n = 1;
+      while (c+n<TC && cell_get(r,c+n)==i) n++;
+      tft.fillRect(r*CH,c*CW,CH,n*CW,color);
+      mark_cleared_for_blink(r*TC+c,r*TC+c+n);
+      c += n;
+      continue;
+    }
+    cells_set_attributes(cell_attrs[cell_attr[i]]);
+    row = r;
+    col = c;
+    cell_code = cell_codes[i];
+    draw_unicode(cell_code);
+    c++;
+  }
+}
+
+/** Draw all damaged rows. The drawing state (cursor, attributes, and the
+ *  last glyph, for REP and combining marks) is put back afterwards.
+ */
+void flush_cells() {
+  if (!cells_damaged) return;
+  byte attrs[SGR_REGISTERS];
+  byte bitmap[CH];
+  cells_get_attributes(attrs);
+  memcpy(bitmap,char_bitmap,CH);
+  byte r0=row, c0=col, pr=prev_row, pc=prev_col;
+  byte ok=combining_ok, new_ok=new_combining_ok;
+  combining_ok = 0;
+  for (byte r=0; r<TR; r++) if (cells_damaged & BLINK_ROW(r)) cells_draw_row(r);
+  cells_damaged = 0;
+  cells_set_attributes(attrs);
+  memcpy(char_bitmap,bitmap,CH);
+  row=r0; col=c0; prev_row=pr; prev_col=pc;
+  combining_ok=ok; new_combining_ok=new_ok;
+}
+
+/** Has damage been waiting long enough that we should draw it now? */
+byte cells_flush_due() {
+  return cells_damaged && !sync_output
+      && (byte)(timer_ticks-cells_damage_tick)>=CELL_FLUSH_TICKS;
+}
+
+/** Draw the damage if it has been waiting too long */
+void flush_cells_if_due() {
+  if (cells_flush_due()) flush_cells();
+}
+
+/** Are all cells on row r known? */
+byte cells_row_known(byte r) {
+  for (byte c=0; c<TC; c++) if (!cell_get(r,c)) return 0;
+  return 1;
+}
+
+/** Forget rows and columns lo..hi, left..right, inclusive, after they have
+ *  been drawn over in a way the model can't follow.
+ */
+void cells_unknown(byte lo, byte hi, byte left, byte right) {
+  for (byte r=lo; r<=hi; r++) for (byte c=left; c<=right; c++) cell_put(r,c,0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Hooks for terminal_misc.h
+
+/** Cells start..end-1, counting from the bottom left, have been cleared to
+ *  the background color. Clearing a whole row also draws it.
+ */
+void cells_erase(unsigned int start, unsigned int end) {
+  byte i = cells_blank_entry();
+  while (start<end) {
+    byte r = start/TC;
+    byte c = start%TC;
+    byte c1 = min(end-(unsigned int)r*TC, TC);
+    if (!c && c1==TC) cells_damaged &= ~BLINK_ROW(r);
+    for (; c<c1; c++) cell_put(r,c,i);
+    start = (unsigned int)r*TC+c1;
+  }
+}
+
+/** The screen has been cleared */
+void cells_reset() {
+  for (byte r=0; r<TR; r++) cell_line[r] = r;
+  cells_damaged = 0;
+  cells_erase(0,TR*TC);
+}
+
+/** Scroll rows lo..hi of the model, as scroll_region(). If every cell that
+ *  moves is known, the moved rows are marked damaged and this returns 1:
+ *  the caller doesn't need to move the pixels. Otherwise the damage is
+ *  drawn first, so that the pixels can be read back, and this returns 0.
+ *  Either way, the caller clears the rows scrolled in, and then calls
+ *  flush_cells_if_due().
+ */
+byte cells_scroll(byte lo, byte hi, int scroll_rows) {
+  byte    n     = hi-lo+1;
+  byte    shift = min(abs(scroll_rows),n);
+  boolean up    = scroll_rows>0;
+  byte    model = 1;
+  for (byte r=up? lo : lo+shift; r<=(up? hi-shift : hi) && shift<n; r++)
+    if (!cells_row_known(r)) {model = 0; break;}
+  if (!model) flush_cells();
+  // Rotate the lines; those scrolled out come back in as blank rows
+  byte lines[TR];
+  uint32_t damaged = cells_damaged;
+  for (byte r=lo; r<=hi; r++) {
+    byte from = up? (r>=lo+shift? r-shift : r+n-shift)
+                  : (r+shift<=hi? r+shift : r+shift-n);
+    lines[r] = cell_line[from];
+    cells_damaged &= ~BLINK_ROW(r);
+    if ((damaged & BLINK_ROW(from)) || model) cells_damaged |= BLINK_ROW(r);
+  }
+  for (byte r=lo; r<=hi; r++) cell_line[r] = lines[r];
+  byte new_lo = up? lo : hi+1-shift;
+  cells_erase(new_lo*TC,(new_lo+shift)*TC);
+  if (cells_damaged && !damaged) cells_damage_tick = timer_ticks;
+  return model;
+}
+
+/** Shift cells from column c to the end of row r right by n (ICH), or left
+ *  by -n (DCH). Cells shifted in are unknown; the caller clears them.
+ */
+void cells_shift(byte r, byte c, int n) {
+  // The row's pixels are about to be read back
+  if (cells_damaged & BLINK_ROW(r)) flush_cells();
+  byte i;
+  if (n>0) for (i=TC-1; i>=c+n; i--) cell_put(r,i,cell_get(r,i-n));
+  else     for (i=c; i<TC+n; i++)    cell_put(r,i,cell_get(r,i-n));
+}
+
+/** A glyph n cells wide has been drawn at the cursor, from cell_code, which
+ *  the caller sets (0 if it isn't a codepoint we can draw again). Called by
+ *  advance_cursor() before it moves the cursor.
+ */
+void cells_drawn(byte n) {
+  byte i = 0;
+  // Combining marks go over the previous glyph, and we don't model those
+  if (n==1 && !(combining_ok && row==prev_row && col==prev_col)) {
+    byte attrs[SGR_REGISTERS];
+    cells_get_attributes(attrs);
+    i = cells_entry(cell_code,attrs);
+  }
+  for (byte c=col; c<col+n && c<TC; c++) cell_put(row,c,i);
+  cell_code = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Hook for the parser
+
+/** Called before drawing a graphic character. Returns 1 if the cell at the
+ *  cursor already shows it, or will once its row is flushed; the cursor
+ *  has then been advanced, and there's nothing to draw.
+ */
+byte cells_write(uint32_t code) {
+  if (code>=0x300 || uart_peek()>=0x80) return 0;
+  prepare_cursor();
+  byte attrs[SGR_REGISTERS];
+  cells_get_attributes(attrs);
+  byte i = cells_entry(code,attrs);
+  if (!i) return 0;
+  if (cells_damaged & BLINK_ROW(row)) {
+    if (cells_flush_due()) {flush_cells(); return 0;}
+    cell_put(row,col,i);
+    update_blink(row,col);
+  }
+  else if (cell_get(row,col)!=i) return 0;
+  col++;
+  return 1;
+}
+
+#else
+
+void flush_cells() {}
+void flush_cells_if_due() {}
+void cells_unknown(byte lo, byte hi, byte left, byte right) {}
+void cells_erase(unsigned int start, unsigned int end) {}
+void cells_reset() {}
+byte cells_scroll(byte lo, byte hi, int scroll_rows) {return 0;}
+void cells_shift(byte r, byte c, int n) {}
+void cells_drawn(byte n) {}
+byte cells_write(uint32_t code) {return 0;}
+
+#endif // CELL_MODEL
+
+#endif // CELLS_H
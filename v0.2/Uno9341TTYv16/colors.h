@@ -30,8 +30,13 @@
 #define CYAN    0b00011111
 #define WHITE   0b11111111
 
-// 16-color pallet, ANSI terminal
-const uint8_t color_cycle[16] = {
+// 16-color pallet, ANSI terminal, followed by the default foreground and 
+// background colors. The terminal keeps a copy in SRAM, `color_cycle`, which
+// OSC 4/10/11 can change. 
+#define PALETTE_FG   (16)
+#define PALETTE_BG   (17)
+#define PALETTE_SIZE (18)
+const uint8_t default_color_cycle[PALETTE_SIZE] PROGMEM = {
   BLACK,
   DKRED,
   DKGREEN,
@@ -48,6 +53,33 @@ const uint8_t color_cycle[16] = {
   MAGENTA,
   CYAN,
   WHITE,
+  WHITE, // Default foreground
+  BLACK, // Default background
+};
+
+// xterm 256-color pallet entries 16-255: a 6x6x6 color cube (levels 
+// 0,51,102,153,204,255), then 24 greys from 0 to 255, packed as RRRBBGGG
+const uint8_t xterm_colors[240] PROGMEM = {
+  0x00,0x00,0x08,0x10,0x18,0x18,0x01,0x01,0x09,0x11,0x19,0x19, // 16-27
+  0x03,0x03,0x0B,0x13,0x1B,0x1B,0x04,0x04,0x0C,0x14,0x1C,0x1C, // 28-39
+  0x06,0x06,0x0E,0x16,0x1E,0x1E,0x07,0x07,0x0F,0x17,0x1F,0x1F, // 40-51
+  0x20,0x20,0x28,0x30,0x38,0x38,0x21,0x21,0x29,0x31,0x39,0x39, // 52-63
+  0x23,0x23,0x2B,0x33,0x3B,0x3B,0x24,0x24,0x2C,0x34,0x3C,0x3C, // 64-75
+  0x26,0x26,0x2E,0x36,0x3E,0x3E,0x27,0x27,0x2F,0x37,0x3F,0x3F, // 76-87
+  0x60,0x60,0x68,0x70,0x78,0x78,0x61,0x61,0x69,0x71,0x79,0x79, // 88-99
+  0x63,0x63,0x6B,0x73,0x7B,0x7B,0x64,0x64,0x6C,0x74,0x7C,0x7C, // 100-111
+  0x66,0x66,0x6E,0x76,0x7E,0x7E,0x67,0x67,0x6F,0x77,0x7F,0x7F, // 112-123
+  0x80,0x80,0x88,0x90,0x98,0x98,0x81,0x81,0x89,0x91,0x99,0x99, // 124-135
+  0x83,0x83,0x8B,0x93,0x9B,0x9B,0x84,0x84,0x8C,0x94,0x9C,0x9C, // 136-147
+  0x86,0x86,0x8E,0x96,0x9E,0x9E,0x87,0x87,0x8F,0x97,0x9F,0x9F, // 148-159
+  0xC0,0xC0,0xC8,0xD0,0xD8,0xD8,0xC1,0xC1,0xC9,0xD1,0xD9,0xD9, // 160-171
+  0xC3,0xC3,0xCB,0xD3,0xDB,0xDB,0xC4,0xC4,0xCC,0xD4,0xDC,0xDC, // 172-183
+  0xC6,0xC6,0xCE,0xD6,0xDE,0xDE,0xC7,0xC7,0xCF,0xD7,0xDF,0xDF, // 184-195
+  0xE0,0xE0,0xE8,0xF0,0xF8,0xF8,0xE1,0xE1,0xE9,0xF1,0xF9,0xF9, // 196-207
+  0xE3,0xE3,0xEB,0xF3,0xFB,0xFB,0xE4,0xE4,0xEC,0xF4,0xFC,0xFC, // 208-219
+  0xE6,0xE6,0xEE,0xF6,0xFE,0xFE,0xE7,0xE7,0xEF,0xF7,0xFF,0xFF, // 220-231
+  0x00,0x00,0x00,0x21,0x21,0x21,0x4A,0x4A,0x4A,0x6B,0x6B,0x6B, // 232-243
+  0x94,0x94,0x94,0xB5,0xB5,0xB5,0xDE,0xDE,0xDE,0xFF,0xFF,0xFF, // 244-255
 };
 
 // Other colors
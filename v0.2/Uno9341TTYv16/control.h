@@ -20,9 +20,16 @@ escape sequence into another buffer. These constants set the maximum number of
 bytes in the escape sequence parameters (and maximum number of parameters)
 */
 
-#define CSMAXBYTES (24)
+#define CSMAXBYTES (32)
 #define CSBUFFERLEN (CSMAXBYTES+2)
 
+// Private mode for synchronized output
+#define SYNC_MODE (2026)
+// Private mode for glyph words in place of characters (parser.h)
+#define GLYPH_WORD_MODE (903)
+// rep_code for a glyph word, rather than a codepoint, has this bit set
+#define REP_GLYPH_WORD (0x1000000UL)
+
 /** Read numeric parameters from a CSI code.
  *  "s" must be null-terminated.
  */
@@ -53,101 +60,143 @@ int read_csi_arguments(const byte *s, uint16_t *cs_parse_buff) {
  *  Used to respond to requests for cursor position
  */
 void serial_write_decimal(byte value) {
-  Serial.write('0'+value/100); 
+  uart_write('0'+value/100); 
   value%=100;
-  Serial.write('0'+value/10); 
+  uart_write('0'+value/10); 
   value%=10;
-  Serial.write('0'+value);
+  uart_write('0'+value);
 } 
 
-/** Set color register based on CSI code for 256/12-bit modes
+// Bytes of the control sequence being received. The byte-at-a-time parser
+// (parser.h) fills these in, then calls parse_SGR or parse_CSI_sequence on the
+// final byte.
+byte cs_param_buff[CSBUFFERLEN]; // store parameter bytes from CSI code
+byte n_cs_param_bytes = 0;
+byte cs_final_byte    = 0;
+byte cs_intermediate  = 0; // Intermediate byte, if any; 0xFF if more than one
+
+/** Repeat the most recent graphic character n times (REP).
+ *  Glyphs from the font map are left in char_bitmap, already styled, so we 
+ *  only need to blit them again. Bold, italic, and the other font modes have 
+ *  been applied to the bitmap, so don't apply them twice. Glyphs from the 
+ *  soft-fonts are drawn directly, and must be drawn again from scratch. 
+ *  @param n: number of times to repeat
  */
-int set_color_csi(byte *color_register, const uint16_t *cs_parse_buff, int nread) {
-  int r,g,b;
-  if (nread<3) return FAIL;
-  if (cs_parse_buff[1]==5) {
-    // Color as index into 256-color pallet
-    if (!(nread==3)) return FAIL;
-    uint16_t n = cs_parse_buff[2];
-    if (n>255) return FAIL;
-    if (n<16) { // 16-color pallet
-      *color_register = color_cycle[n];
-      // Return number of parameters consumed so we can continue parsing 
-      // additional parameters and codes, if present. 
-      return SUCCESS;
-    } 
-    if (n<232) { // 6,6,6 cube
-      n -= 16;
-      b = ((n%6)*255)/5;
-      g = (((n/6)%6)*255)/5;
-      r = (((n/36)%6)*255)/5;
+void draw_glyph_word(uint16_t w); // parser.h
+void repeat_character(uint16_t n) {
+  if (!rep_code) return;
+  byte weight = font_weight==FAINT? FAINT : NORMAL;
+  while (n--) {
+    cell_code = rep_code;
+    #ifdef GLYPH_WORDS
+    // The cell model only knows codepoints, as in draw_glyph_word
+    if (rep_code&REP_GLYPH_WORD) cell_code = 0;
+    #endif
+    if (!rep_loaded) {
+      #ifdef GLYPH_WORDS
+      if (rep_code&REP_GLYPH_WORD) {draw_glyph_word(rep_code); continue;}
+      #endif
+      rep_loaded = draw_unicode(rep_code)==LOADED;
+      continue;
     }
-    else r=g=b=((n-232)*255)/23; // greyscale
-  } else if (cs_parse_buff[1]==2) {
-    // Color as RGB tuple
-    if (!(nread==5)) return FAIL;
-    r = cs_parse_buff[2];
-    g = cs_parse_buff[3];
-    b = cs_parse_buff[4];
+    prepare_cursor();
+    drawCharFancy(CH*row,CW*col,fg,bg,weight,NORMAL,HALFWIDTH);
+    advance_cursor(1);
   }
-  else return FAIL;
-  // Format is RRR BB GGG
-  if (r>255) return FAIL;
-  if (g>255) return FAIL;
-  if (b>255) return FAIL;
-  *color_register = (byte)(
-    (r&0b11100000)|((b>>3)&0b00011000)|((g>>5)&0b00000111)
-  ); 
+}
+
+/** Reply to a mode request, CSI ? Pn $ p (DECRQM), with CSI ? Pn ; Ps $ y.
+ *  Ps is 1 if the mode is set, 2 if reset, and 0 if we don't know it. 
+ *  mode is space for the parsed arguments (the caller's cs_parse_buff).
+ */
+int report_mode(uint16_t *mode) {
+  if (cs_param_buff[0]!='?') return FAIL;
+  if (read_csi_arguments(&cs_param_buff[1], mode)!=1) return FAIL;
+  byte state = 0;
+  if (mode[0]==SYNC_MODE) state = sync_output? 1 : 2;
+  if (mode[0]==25) state = cursor_visible? 1 : 2;
+  #ifdef GLYPH_WORDS
+  if (mode[0]==GLYPH_WORD_MODE) state = glyph_words? 1 : 2;
+  #endif
+  #ifdef LZ_INPUT
+  if (mode[0]==LZ_MODE) state = uart_lz_state? 1 : 2;
+  #endif
+  uart_print("\x1b[?");
+  uart_write_uint(mode[0]); uart_write(';');
+  uart_write('0'+state);
+  uart_print("$y");
   return SUCCESS;
 }
- 
+
+int parse_rectangle_op(); // rectangles.h
+
 /** Parse and respond to escape sequence
  *  SCI compliant escape codes:
  *  ESC [ is followed by any number (including none) of "parameter bytes" in the range 0x30–0x3F (ASCII 0–9:;<=>?), 
  *  then by any number of "intermediate bytes" in the range 0x20–0x2F (ASCII space and !"#$%&'()*+,-./),
  *  then finally by a single "final byte" in the range 0x40–0x7E (ASCII @A–Z[\]^_`a–z{|}~)
+ *  The parameter bytes (null terminated) and final byte have already been 
+ *  received into cs_param_buff and cs_final_byte. A single intermediate 
+ *  byte is kept in cs_intermediate. 
  */
 int parse_CSI_sequence() 
 {  
-  // buffers to hold bytes from control sequences as we receive and parse them
-  // (and variables to keep track of how many bytes read)
-  byte  cs_param_buff[CSBUFFERLEN]; // store parameter bytes from CSI code
-  //byte  cs_inter_buff[CSBUFFERLEN]; // store intermediate bytes ""
   uint16_t cs_parse_buff[CSBUFFERLEN]; // store parsed integer arguments, semicolon separated, for CSI
-  byte  n_cs_param_bytes = 0;
-  //byte  n_cs_inter_bytes = 0;
-  byte  cs_final_byte    = 0;
-
-  // Get parameter bytes 
-  byte i;
-  byte inByte = blocking_read();
-  for (i=0; i<CSMAXBYTES; i++) {
-    if (!(0x30<=inByte && inByte<=0x3f)) break;
-    cs_param_buff[i] = inByte;
-    inByte = blocking_read();
-  }
-  if (i>=CSMAXBYTES) return FAIL; // buffer overflow (bad/unsupported code)
-  n_cs_param_bytes = i;
-  cs_param_buff[i] = 0; // Null terminate, important!
   
-  // Get intermediate bytes
-  for (i=0; i<CSMAXBYTES; i++) {
-    if (!(0x20<=inByte && inByte<=0x2f)) break;
-    //cs_inter_buff[i] = inByte;
-    inByte = blocking_read();
+  // Sequences with an intermediate byte
+  if (cs_intermediate) {
+    if (cs_intermediate=='$' && cs_final_byte=='p') return report_mode(cs_parse_buff);
+    if (cs_intermediate==' ' && cs_final_byte=='q') {
+      // Cursor style (DECSCUSR)
+      int nread = read_csi_arguments(cs_param_buff, cs_parse_buff);
+      if (nread<0 || (nread && cs_parse_buff[0]>6)) return FAIL;
+      cursor_style = nread && cs_parse_buff[0]? cs_parse_buff[0] : CURSOR_DEFAULT;
+      return SUCCESS;
+    }
+    #ifdef RECTANGLE_OPS
+    if (cs_intermediate=='$') return parse_rectangle_op();
+    #endif
+    return FAIL;
   }
-  if (i>=CSMAXBYTES) return FAIL; // buffer overflow (bad/unsupported code)
-  //n_cs_inter_bytes = i;
-  //cs_inter_buff[i] = 0; // Null terminate, important!
-  
-  if (!(0x40<=inByte && inByte<=0x7E)) return FAIL; // bad final byte
-  cs_final_byte = inByte;
   
   // Show/hide cursor [?25h [?2fl are handled as a special cases 
   if (n_cs_param_bytes>0 && cs_param_buff[0]=='?') {
     // Private use sequences, get numeric arguments if any
     int nread = read_csi_arguments(&cs_param_buff[1], cs_parse_buff);
-    if (nread!=1 || cs_parse_buff[0]!=25) return FAIL;
+    if (nread==2 && cs_parse_buff[0]==UART_SWITCH_BAUD && cs_final_byte=='p')
+      return uart_switch_baud(100UL*cs_parse_buff[1]);
+    if (nread!=1) return FAIL;
+    if (cs_parse_buff[0]==UART_STATUS_REPORT && cs_final_byte=='n') {
+      uart_status_report();
+      return SUCCESS;
+    }
+    if (cs_parse_buff[0]==LOOKAHEAD_REPORT && cs_final_byte=='n') {
+      lookahead_report();
+      return SUCCESS;
+    }
+    if (cs_parse_buff[0]==SYNC_MODE) {
+      switch (cs_final_byte) {
+        case 'h': begin_sync(); break;
+        case 'l': end_sync();   break;
+        default: return FAIL;
+      }
+      return SUCCESS;
+    }
+    #ifdef GLYPH_WORDS
+    if (cs_parse_buff[0]==GLYPH_WORD_MODE) {
+      switch (cs_final_byte) {
+        case 'h': glyph_words = 1; break;
+        case 'l': glyph_words = 0; break;
+        default: return FAIL;
+      }
+      return SUCCESS;
+    }
+    #endif
+    #ifdef LZ_INPUT
+    // The receive interrupt has already switched to compressed input
+    if (cs_parse_buff[0]==LZ_MODE && cs_final_byte=='h') return SUCCESS;
+    #endif
+    if (cs_parse_buff[0]!=25) return FAIL;
     switch (cs_final_byte) {
       case 'h': show_cursor(); break;
       case 'l': hide_cursor(); break;
@@ -190,7 +239,6 @@ int parse_CSI_sequence()
   // command with one or zero numerical arguments
   if ('A'<=cs_final_byte && cs_final_byte<='G') {
     int16_t n = nread? cs_parse_buff[0] : 1;
-    cstamp();  
     switch (cs_final_byte) {
       case 'F': // Up, start of line
         col=0; 
@@ -216,10 +264,8 @@ int parse_CSI_sequence()
         col = min(TC,n)-1;
         break;
       default: // Should never reach here
-        cstamp();  
         return FAIL; 
     }
-    cstamp();
     return SUCCESS;
   }
   
@@ -227,123 +273,11 @@ int parse_CSI_sequence()
   // command with up to two arguments.
   else if (cs_final_byte=='H' || cs_final_byte=='f') { 
     // "Cursor position" and "Horizontal Vertical Position" (H,f)
-    cstamp();  
     row = nread<1? TR-1
       : max(0,min(TR-1,TR-max(1,cs_parse_buff[0])));
     col = nread<2? 0 : ((byte)max(1,min(TC,cs_parse_buff[1]))-1);
-    cstamp();  
     return SUCCESS; 
   }
-  
-  // If the final byte is m, expect a sequence of Select Graphic Rendition (SGR)
-  // parameters, separated by semicolons. These semicolon-delimited arguments
-  // have already been parsed by "read_csi_arguments", and are stored in 
-  // the buffer "cs_parse_buff". The variable nread describes how many
-  // parameters were read. We need to continue reading commands until the 
-  // sequence is exhausted. 
-  // TODO: I need to adjust the color-parsing code to play nicely with this.
-  // 
-  else if (cs_final_byte=='m') {
-    // There should always be at least one argument
-    if (nread<1) return FAIL;
-    
-    for (byte param_i=0; param_i<nread; param_i++) {
-      
-      byte code = (byte)cs_parse_buff[param_i];
-      // Parameters should be <256
-      if (code>255) return FAIL;
-      
-      // Keep this as a consecutive order with the hope that the compiler
-      // converts it to a fast jump table.
-      switch (code) {
-        case 0 : reset_text_attributes();      break; //Reset all text attributes
-        case 1 : font_weight    = BOLD;        break; //Bold intensity
-        case 2 : font_weight    = FAINT;       break; //Faint intensity
-        case 3 : font_mode      = ITALIC;      break; //Italic style
-        case 4 : underline_mode = SINGLE;      break; //Underline
-        case 5 : blink_mode     = BLINK;       break; //Slow blink
-        case 6 : blink_mode     = FASTBLINK;   break; //Rapid blink
-        case 7 : invert         = INVERT;      break; //Invert
-        case 8 :                               break; //Conceal (not supported)
-        case 9 : strike_mode    = STRIKE;      break; //Crossed-out
-        case 10: font_mode      = NORMAL;      break; //Default font mode; interpreted here as same as code 23
-        case 11: font_mode      = OUTLINE;     break; //Alt font 1 will try to approximate blackboard bold
-        case 12: font_mode      = TABLET;      break; //Encase letters in rounded rectangle
-        case 13: font_mode      = NORMAL;      break; //Other alternative fonts are not defined
-        case 14: font_mode      = NORMAL;      break; // ... could be implemented as weird variants on bold
-        case 15: font_mode      = NORMAL;      break; // ... unsupported font
-        case 16: font_mode      = NORMAL;      break; // ... unsupported font
-        case 17: font_mode      = NORMAL;      break; // ... unsupported font
-        case 18: font_mode      = NORMAL;      break; // ... unsupported font
-        case 19: font_mode      = NORMAL;      break; // ... unsupported font
-        case 20: font_mode      = FRAKTUR;     break; //Fraktur style (implemented as "very bold")
-        case 21: underline_mode = DOUBLE;      break; //Doube underlined
-        case 22: font_weight    = NORMAL;      break; //Normal intensity
-        case 23: font_mode      = NORMAL;      break; //Remove italic or fraktur style
-        case 24: underline_mode = NORMAL;      break; //Not underlined
-        case 25: blink_mode     = NORMAL;      break; //Not blinking 	
-        case 26:                               break; //Proportional spacing; not supported
-        case 27: invert         = NORMAL;      break; //Not inverted
-        case 28:                               break; //Reveal (not concealed); not supported
-        case 29: strike_mode    = NORMAL;      break; //Not crossed out 
-        case 30: fg = color_cycle[8];          break; //Foreground colors
-        case 31: fg = color_cycle[9];          break;
-        case 32: fg = color_cycle[10];         break;
-        case 33: fg = color_cycle[11];         break;
-        case 34: fg = color_cycle[12];         break;
-        case 35: fg = color_cycle[13];         break;
-        case 36: fg = color_cycle[14];         break;
-        case 37: fg = color_cycle[15];         break;
-        case 38://Set foreground color; Next arguments are 5;n or 2;r;g;b
-          return set_color_csi(&fg,&cs_parse_buff[param_i],nread-param_i); // TODO
-        case 39: fg             = FG_DEFAULT;  break; //Default foreground color
-        case 40: bg = color_cycle[0];          break; //Background colors
-        case 41: bg = color_cycle[1];          break; //Background colors
-        case 42: bg = color_cycle[2];          break; //Background colors
-        case 43: bg = color_cycle[3];          break; //Background colors
-        case 44: bg = color_cycle[4];          break; //Background colors
-        case 45: bg = color_cycle[5];          break; //Background colors
-        case 46: bg = color_cycle[6];          break; //Background colors
-        case 47: bg = color_cycle[7];          break; //Background colors
-        case 48://Set background color; Next arguments are 5;n or 2;r;g;b
-          return set_color_csi(&bg,&cs_parse_buff[param_i],nread-param_i); // TODO
-        case 49: bg             = BG_DEFAULT;  break; //Default background color
-        case 50:                               break; //Disable proportional spacing; not supported
-        case 51: frame_mode     = FRAMED;      break; //Supposed to be a "framed" effect
-        case 52: frame_mode     = ENCIRCLED;   break; //Supposed to be an "encircled" effect
-        case 53: overline_mode  = SINGLE;      break; //Overlined
-        case 54: frame_mode     = NORMAL;      break; //Clear framed/circled effect
-        case 55: overline_mode  = NORMAL;      break; //Not overlined 
-        case 56: break; // Available for private use?
-        case 57: break; // Available for private use?
-        case 58://Set underline color. Next arguments are 5;n or 2;r;g;b.
-          return set_color_csi(&ul,&cs_parse_buff[param_i],nread-param_i); // TODO
-        case 59: ul             = FG_DEFAULT;  break; //Default underline color
-        case 60: underline_mode = SINGLE;      break; //Ideogram line mapped to underline
-        case 61: underline_mode = DOUBLE;      break; //Ideogram double line mapped to double underline
-        case 62: overline_mode  = SINGLE;      break; //Ideogram overline mapped to overline
-        case 63: overline_mode  = DOUBLE;      break; //Ideogram double overline as double overline
-        case 64: break; //Ideogram stress marking not supported
-        case 65: //"No ideogram attributes" mapped to "not overlined or underlined" 
-          underline_mode = overline_mode = NORMAL; break; 
-        case 66: break; // Available for private use?
-        case 67: break; // Available for private use?
-        case 68: break; // Available for private use?
-        case 69: break; // Available for private use?
-        case 70: break; // Available for private use?
-        case 71: break; // Available for private use?
-        case 72: break; // Available for private use?
-        case 73: script_mode    = SUPERSCRIPT; break; //Superscript mode (not yet implemented)
-        case 74: script_mode    = SUBSCRIPT;   break; //Subscript mode (not yet implemented)
-        case 75: script_mode    = NORMAL;      break; //Ecit sub/superscript mode
-        default:
-          //90–97 Set bright foreground color 
-          if      (code>=90  && code<=97 ) fg = color_cycle[code-90+8];
-          //100–107 Set underline color
-          else if (code>=100 && code<=107) ul = color_cycle[code-100+8];
-      } // end switch
-    } // end parameter loop
-  }
   else 
   {
     // Control cod is neither navigation nor style selector  
@@ -351,37 +285,53 @@ int parse_CSI_sequence()
     byte n;
     switch (cs_final_byte) {
       case 'J': // Vertical clear/reset commands
-        cstamp();
         n=nread?cs_parse_buff[0]:0;
         switch (n) {
           case 0: clear_right(); clear_below(); break;
           case 1: clear_left();  clear_above(); break;
           case 2: // clear: 2:screen 3:screen+scrollback
           case 3: reset_screen(); break;
-          default: cstamp(); return FAIL; 
+          default: return FAIL; 
         }  
-        cstamp(); 
         break;
       case 'K': // Horizontal clear/reset commands
-        cstamp(); 
         n=nread?cs_parse_buff[0]:0;
         switch (n) {
           case 0: clear_right(); break;
           case 1: clear_left();  break;
           case 2: clear_line();  break;
-          default: cstamp(); return FAIL;
+          default: return FAIL;
         }  
-        cstamp(); 
         break;
-      case 'S': n = nread?cs_parse_buff[0]:1; cstamp(); scroll(n);  cstamp(); break; // Scroll up
-      case 'T': n = nread?cs_parse_buff[0]:1; cstamp(); scroll(-n); cstamp(); break; // Scroll down
+      case 'X': // Erase characters, without moving the cursor
+        n = nread? min(TC,max(1,cs_parse_buff[0])) : 1; 
+        clear_chars(n); 
+        break;
+      case 'L': // Insert lines
+      case 'M': // Delete lines
+        n = nread? min(TR,max(1,cs_parse_buff[0])) : 1; 
+        if (cs_final_byte=='L') insert_lines(n); else delete_lines(n); 
+        break;
+      case '@': // Insert characters
+      case 'P': // Delete characters
+        n = nread? min(TC,max(1,cs_parse_buff[0])) : 1; 
+        if (cs_final_byte=='@') insert_chars(n); else delete_chars(n); 
+        break;
+      case 'b': // Repeat the preceding character
+        repeat_character(nread? max(1,cs_parse_buff[0]) : 1); 
+        break;
+      case 'S': n = nread?cs_parse_buff[0]:1; scroll(n);  break; // Scroll up
+      case 'T': n = nread?cs_parse_buff[0]:1; scroll(-n); break; // Scroll down
       case 'n': // '6n' is REQUEST_POSITION
         if (!(nread && cs_parse_buff[0]==6)) return FAIL;
-        Serial.write("\x1b[");
+        uart_print("\x1b[");
         serial_write_decimal(row);
-        Serial.write(';');
+        uart_write(';');
         serial_write_decimal(col);
-        Serial.write('R');
+        uart_write('R');
+        break;
+      case 'r': // Set scrolling region
+        set_margins(nread>0? cs_parse_buff[0]:0, nread>1? cs_parse_buff[1]:0);
         break;
       case 's': save_cursor();    break; // save cursor
       case 'u': restore_cursor(); break; // restore cursor
@@ -392,4 +342,374 @@ int parse_CSI_sequence()
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+// Select Graphic Rendition (SGR), CSI ... m
+//
+// SGR parameters are applied one at a time, straight from cs_param_buff, 
+// using a table giving the register each code sets and its new value. Colors
+// 38/48/58 take 5;n or 2;r;g;b, or the colon forms 5:n, 2:r:g:b and
+// 2:id:r:g:b, and parameters after them are applied too.
+
+// Registers set by SGR codes, indexing sgr_registers
+#define SGR_INVERT      (0)
+#define SGR_WEIGHT      (1)
+#define SGR_FONT        (2)
+#define SGR_BLINK       (3)
+#define SGR_UNDERLINE   (4)
+#define SGR_OVERLINE    (5)
+#define SGR_STRIKE      (6)
+#define SGR_FRAME       (7)
+#define SGR_SCRIPT      (8)
+#define SGR_FG          (9)
+#define SGR_BG          (10)
+#define SGR_UL          (11)
+// Codes that aren't a single assignment
+#define SGR_IGNORE      (12) // Not supported
+#define SGR_RESET       (13) // Reset all text attributes
+#define SGR_EXTENDED    (14) // 38/48/58, value is the color register
+#define SGR_NO_IDEOGRAM (15) // Not underlined or overlined
+// Flag: value is an index into the pallet, color_cycle
+#define SGR_PALETTE     (0x80)
+#define SGR_CODES       (108)
+
+byte * const sgr_registers[] PROGMEM = {
+  &invert, &font_weight, &font_mode, &blink_mode, &underline_mode, 
+  &overline_mode, &strike_mode, &frame_mode, &script_mode, &fg, &bg, &ul
+};
+#define SGR_REGISTERS (sizeof(sgr_registers)/sizeof(*sgr_registers))
+
+// Register (or action) and value for each SGR code
+const byte sgr_table[SGR_CODES][2] PROGMEM = {
+  {SGR_RESET,      0          }, // 0  Reset all text attributes
+  {SGR_WEIGHT,     BOLD       }, // 1  Bold intensity
+  {SGR_WEIGHT,     FAINT      }, // 2  Faint intensity
+  {SGR_FONT,       ITALIC     }, // 3  Italic style
+  {SGR_UNDERLINE,  SINGLE     }, // 4  Underline
+  {SGR_BLINK,      BLINK      }, // 5  Slow blink
+  {SGR_BLINK,      FASTBLINK  }, // 6  Rapid blink
+  {SGR_INVERT,     INVERT     }, // 7  Invert
+  {SGR_IGNORE,     0          }, // 8  Conceal (not supported)
+  {SGR_STRIKE,     STRIKE     }, // 9  Crossed-out
+  {SGR_FONT,       NORMAL     }, // 10 Default font mode; interpreted here as same as code 23
+  {SGR_FONT,       OUTLINE    }, // 11 Alt font 1 will try to approximate blackboard bold
+  {SGR_FONT,       TABLET     }, // 12 Encase letters in rounded rectangle
+  {SGR_FONT,       NORMAL     }, // 13 Other alternative fonts are not defined
+  {SGR_FONT,       NORMAL     }, // 14 ... could be implemented as weird variants on bold
+  {SGR_FONT,       NORMAL     }, // 15 ... unsupported font
+  {SGR_FONT,       NORMAL     }, // 16 ... unsupported font
+  {SGR_FONT,       NORMAL     }, // 17 ... unsupported font
+  {SGR_FONT,       NORMAL     }, // 18 ... unsupported font
+  {SGR_FONT,       NORMAL     }, // 19 ... unsupported font
+  {SGR_FONT,       FRAKTUR    }, // 20 Fraktur style (implemented as "very bold")
+  {SGR_UNDERLINE,  DOUBLE     }, // 21 Doube underlined
+  {SGR_WEIGHT,     NORMAL     }, // 22 Normal intensity
+  {SGR_FONT,       NORMAL     }, // 23 Remove italic or fraktur style
+  {SGR_UNDERLINE,  NORMAL     }, // 24 Not underlined
+  {SGR_BLINK,      NORMAL     }, // 25 Not blinking
+  {SGR_IGNORE,     0          }, // 26 Proportional spacing; not supported
+  {SGR_INVERT,     NORMAL     }, // 27 Not inverted
+  {SGR_IGNORE,     0          }, // 28 Reveal (not concealed); not supported
+  {SGR_STRIKE,     NORMAL     }, // 29 Not crossed out
+  {SGR_FG|SGR_PALETTE, 8      }, // 30 Foreground colors
+  {SGR_FG|SGR_PALETTE, 9      }, // 31
+  {SGR_FG|SGR_PALETTE, 10     }, // 32
+  {SGR_FG|SGR_PALETTE, 11     }, // 33
+  {SGR_FG|SGR_PALETTE, 12     }, // 34
+  {SGR_FG|SGR_PALETTE, 13     }, // 35
+  {SGR_FG|SGR_PALETTE, 14     }, // 36
+  {SGR_FG|SGR_PALETTE, 15     }, // 37
+  {SGR_EXTENDED,   SGR_FG     }, // 38 Set foreground color; 5;n or 2;r;g;b
+  {SGR_FG|SGR_PALETTE, PALETTE_FG}, // 39 Default foreground color
+  {SGR_BG|SGR_PALETTE, 0      }, // 40 Background colors
+  {SGR_BG|SGR_PALETTE, 1      }, // 41
+  {SGR_BG|SGR_PALETTE, 2      }, // 42
+  {SGR_BG|SGR_PALETTE, 3      }, // 43
+  {SGR_BG|SGR_PALETTE, 4      }, // 44
+  {SGR_BG|SGR_PALETTE, 5      }, // 45
+  {SGR_BG|SGR_PALETTE, 6      }, // 46
+  {SGR_BG|SGR_PALETTE, 7      }, // 47
+  {SGR_EXTENDED,   SGR_BG     }, // 48 Set background color; 5;n or 2;r;g;b
+  {SGR_BG|SGR_PALETTE, PALETTE_BG}, // 49 Default background color
+  {SGR_IGNORE,     0          }, // 50 Disable proportional spacing; not supported
+  {SGR_FRAME,      FRAMED     }, // 51 Supposed to be a "framed" effect
+  {SGR_FRAME,      ENCIRCLED  }, // 52 Supposed to be an "encircled" effect
+  {SGR_OVERLINE,   SINGLE     }, // 53 Overlined
+  {SGR_FRAME,      NORMAL     }, // 54 Clear framed/circled effect
+  {SGR_OVERLINE,   NORMAL     }, // 55 Not overlined
+  {SGR_IGNORE,     0          }, // 56 Available for private use?
+  {SGR_IGNORE,     0          }, // 57 Available for private use?
+  {SGR_EXTENDED,   SGR_UL     }, // 58 Set underline color; 5;n or 2;r;g;b
+  {SGR_UL|SGR_PALETTE, PALETTE_FG}, // 59 Default underline color
+  {SGR_UNDERLINE,  SINGLE     }, // 60 Ideogram line mapped to underline
+  {SGR_UNDERLINE,  DOUBLE     }, // 61 Ideogram double line mapped to double underline
+  {SGR_OVERLINE,   SINGLE     }, // 62 Ideogram overline mapped to overline
+  {SGR_OVERLINE,   DOUBLE     }, // 63 Ideogram double overline as double overline
+  {SGR_IGNORE,     0          }, // 64 Ideogram stress marking not supported
+  {SGR_NO_IDEOGRAM,0          }, // 65 "No ideogram attributes": not overlined or underlined
+  {SGR_IGNORE,     0          }, // 66-72 Available for private use?
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_SCRIPT,     SUPERSCRIPT}, // 73 Superscript mode (not yet implemented)
+  {SGR_SCRIPT,     SUBSCRIPT  }, // 74 Subscript mode (not yet implemented)
+  {SGR_SCRIPT,     NORMAL     }, // 75 Exit sub/superscript mode
+  {SGR_IGNORE,     0          }, // 76-89 Not used
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_IGNORE,     0          },
+  {SGR_FG|SGR_PALETTE, 8      }, // 90-97 Set bright foreground color
+  {SGR_FG|SGR_PALETTE, 9      },
+  {SGR_FG|SGR_PALETTE, 10     },
+  {SGR_FG|SGR_PALETTE, 11     },
+  {SGR_FG|SGR_PALETTE, 12     },
+  {SGR_FG|SGR_PALETTE, 13     },
+  {SGR_FG|SGR_PALETTE, 14     },
+  {SGR_FG|SGR_PALETTE, 15     },
+  {SGR_IGNORE,     0          }, // 98-99 Not used
+  {SGR_IGNORE,     0          },
+  {SGR_UL|SGR_PALETTE, 8      }, // 100-107 Set underline color
+  {SGR_UL|SGR_PALETTE, 9      },
+  {SGR_UL|SGR_PALETTE, 10     },
+  {SGR_UL|SGR_PALETTE, 11     },
+  {SGR_UL|SGR_PALETTE, 12     },
+  {SGR_UL|SGR_PALETTE, 13     },
+  {SGR_UL|SGR_PALETTE, 14     },
+  {SGR_UL|SGR_PALETTE, 15     },
+};
+
+/** Read the next numeric parameter from *s, and move *s past its separator.
+ *  The separator (';', ':', or 0 at the end) is stored in *sep. Empty 
+ *  parameters read as 0.
+ */
+uint16_t next_csi_argument(const byte **s, byte *sep) {
+  const byte *p = *s;
+  uint16_t n = 0;
+  while ('0'<=*p && *p<='9') n = n*10+(*p++-'0');
+  *sep = *p;
+  if (*p) p++;
+  *s = p;
+  return n;
+}
+
+/** Pack 8-bit red, green, blue as RRRBBGGG */
+byte rgb_color(uint16_t r, uint16_t g, uint16_t b) {
+  return (byte)((r&0b11100000)|((b>>3)&0b00011000)|((g>>5)&0b00000111));
+}
+
+/** Color from the xterm 256-color pallet */
+byte xterm_color(byte n) {
+  if (n<16) return color_cycle[n]; // 16-color pallet
+  return pgm_read_byte(&xterm_colors[n-16]);
+}
+
+/** Parse the color following SGR 38/48/58 into a color register. Reads 
+ *  5;n or 2;r;g;b if sep is ';', or a colon-separated group otherwise. 
+ *  Returns FAIL if the sequence ended early; out-of-range colors are skipped.
+ */
+int parse_SGR_color(byte *color_register, const byte **s, byte *sep) {
+  uint16_t arg[4];
+  byte n = 0;
+  byte colon = *sep==':';
+  if (!colon && *sep!=';') return FAIL;
+  uint16_t mode = next_csi_argument(s, sep);
+  if (colon) {
+    // Sub-parameters run to the next ';', we use at most 4
+    while (*sep==':') {
+      uint16_t x = next_csi_argument(s, sep);
+      if (n<4) arg[n++] = x;
+    }
+  } else {
+    byte need = mode==5? 1 : mode==2? 3 : 0;
+    while (n<need) {
+      if (*sep!=';') return FAIL;
+      arg[n++] = next_csi_argument(s, sep);
+    }
+  }
+  if (mode==5 && n>=1) {
+    if (arg[0]<256) *color_register = xterm_color(arg[0]);
+  }
+  else if (mode==2 && n>=3) {
+    // 2:id:r:g:b has a color space id first, which we ignore
+    uint16_t *rgb = &arg[n-3];
+    if (rgb[0]<256 && rgb[1]<256 && rgb[2]<256)
+      *color_register = rgb_color(rgb[0],rgb[1],rgb[2]);
+  }
+  return SUCCESS;
+}
+
+// Bit (1<<register) is set for each SGR register written by apply_SGR
+uint16_t sgr_changed = 0;
+
+/** Apply SGR parameters from s, in one pass */
+int apply_SGR(const byte *s) {
+  // The glyph left in char_bitmap was styled with the old attributes
+  rep_loaded = 0;
+  byte sep;
+  do {
+    uint16_t code = next_csi_argument(&s, &sep);
+    byte reg = SGR_IGNORE, value = 0;
+    if (code<SGR_CODES) {
+      reg   = pgm_read_byte(&sgr_table[code][0]);
+      value = pgm_read_byte(&sgr_table[code][1]);
+    }
+    if (reg & SGR_PALETTE) value = color_cycle[value];
+    reg &= ~SGR_PALETTE;
+    switch (reg) {
+      case SGR_IGNORE: break;
+      case SGR_RESET:  reset_text_attributes(); sgr_changed = ~0; break;
+      case SGR_NO_IDEOGRAM: underline_mode = overline_mode = NORMAL; break;
+      case SGR_EXTENDED: 
+        if (parse_SGR_color((byte*)pgm_read_ptr(&sgr_registers[value]), &s, &sep)==FAIL)
+          return FAIL;
+        sgr_changed |= 1<<value;
+        break;
+      default: 
+        *(byte*)pgm_read_ptr(&sgr_registers[reg]) = value;
+        sgr_changed |= 1<<reg;
+        // Underline style, 4:0 none, 4:1 single, 4:2 double, 4:3+ as single
+        if (code==4 && sep==':') {
+          uint16_t style = next_csi_argument(&s, &sep);
+          underline_mode = style==0? NORMAL : style==2? DOUBLE : SINGLE;
+        }
+    }
+    // Skip any sub-parameters we don't use
+    while (sep==':') next_csi_argument(&s, &sep);
+  } while (sep==';');
+  return sep? FAIL : SUCCESS;
+}
+
+/** Apply SGR parameters, CSI ... m, from cs_param_buff */
+int parse_SGR() {
+  const byte *s = cs_param_buff;
+  // Private sequences such as CSI > ... m aren't SGR
+  if (*s=='<' || *s=='=' || *s=='>' || *s=='?') return FAIL;
+  return apply_SGR(s);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Operating System Commands, ESC ] Ps ; Pt ... (BEL or ST)
+//   OSC 4 ; n ; color ; ...  Redefine pallet entries n<16 (the 256-color 
+//                            entries above 15 are fixed, see colors.h)
+//   OSC 10 ; color           Default foreground (a second color sets OSC 11)
+//   OSC 11 ; color           Default background
+// Colors are rgb:R/G/B with 1-4 hex digits per channel, or #RGB, #RRGGBB etc.
+// Queries (?) and other commands are ignored. The parser hands over one 
+// ;-separated field at a time in cs_param_buff, so commands can be any length.
+
+uint16_t osc_command = 0; // Ps, the first field
+byte     osc_field   = 0; // Index of the field being received
+byte     osc_index   = 0; // OSC 4: pallet entry to set, 0xFF to ignore
+
+/** Read up to `digits` hex digits from *s, scaled to 0-255 as X11 does. 
+ *  Returns -1 if there are none.
+ */
+int read_hex_channel(const byte **s, byte digits) {
+  uint16_t v = 0;
+  byte n = 0;
+  for (; n<digits; n++) {
+    byte c = **s | 0x20; // Lower case
+    if      ('0'<=c && c<='9') c -= '0';
+    else if ('a'<=c && c<='f') c -= 'a'-10;
+    else break;
+    v = (v<<4)|c;
+    (*s)++;
+  }
+  switch (n) {
+    case 0:  return -1;
+    case 1:  return v*17;
+    case 2:  return v;
+    case 3:  return v>>4;
+    default: return v>>8;
+  }
+}
+
+/** Parse an X11 color, rgb:R/G/B or #RGB, into RRRBBGGG */
+int parse_color_spec(const byte *s, byte *color) {
+  byte digits = 4;
+  byte slash  = 1;
+  if (s[0]=='#') {
+    // Same number of digits for each channel, with no separators
+    byte n = 0;
+    while (s[1+n]) n++;
+    if (n%3 || n>12) return FAIL;
+    digits = n/3;
+    slash  = 0;
+    s++;
+  }
+  else if (s[0]=='r' && s[1]=='g' && s[2]=='b' && s[3]==':') s+=4;
+  else return FAIL;
+  int rgb[3];
+  for (byte i=0; i<3; i++) {
+    if (i && slash) {if (*s!='/') return FAIL; s++;}
+    rgb[i] = read_hex_channel(&s, digits);
+    if (rgb[i]<0) return FAIL;
+  }
+  if (*s) return FAIL;
+  *color = rgb_color(rgb[0],rgb[1],rgb[2]);
+  return SUCCESS;
+}
+
+/** Change a pallet entry. Attributes currently set to the default 
+ *  foreground or background follow a change to the default.
+ */
+void set_pallet_entry(byte i, byte color) {
+  byte old = color_cycle[i];
+  if (i==PALETTE_FG) {if (fg==old) fg=color; if (ul==old) ul=color;}
+  if (i==PALETTE_BG && bg==old) bg=color;
+  color_cycle[i] = color;
+}
+
+/** Start of an OSC string */
+void begin_OSC() {
+  osc_command = 0;
+  osc_field   = 0;
+}
+
+/** Handle one OSC field, null-terminated in cs_param_buff. 
+ *  `ok` is zero if the field was too long or had non-ASCII characters.
+ */
+void parse_OSC_field(byte ok) {
+  const byte *s = cs_param_buff;
+  byte sep, color;
+  byte field = osc_field;
+  if (osc_field<255) osc_field++;
+  if (!ok) {
+    if (field==0) osc_command = 0xFFFF;
+    if (osc_command==4 && (field&1)) osc_index = 0xFF;
+    return;
+  }
+  if (field==0) {
+    osc_command = next_csi_argument(&s, &sep);
+    if (sep) osc_command = 0xFFFF;
+  }
+  else if (osc_command==4) {
+    if (field&1) {
+      uint16_t n = next_csi_argument(&s, &sep);
+      osc_index = (n<16 && !sep && *cs_param_buff)? n : 0xFF;
+    }
+    else if (osc_index!=0xFF && parse_color_spec(s, &color)==SUCCESS)
+      set_pallet_entry(osc_index, color);
+  }
+  else if (osc_command==10 || osc_command==11) {
+    // Each further color sets the next dynamic color: 10, 11, ...
+    uint16_t which = osc_command+field-1;
+    if (which<=11 && parse_color_spec(s, &color)==SUCCESS)
+      set_pallet_entry(which==10? PALETTE_FG : PALETTE_BG, color);
+  }
+}
+
 #endif //CONTROL_H
@@ -399,7 +399,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Offsets in 1-79 are mapped.
 // This is a sparse block.  
   G_AL2L|0,     G_AL2L|T_H5,  G_CL|T_H6,    G_EL|T_H5,    G_EL|T_TL,    G_O2L|0,      G_O2L|T_H6,   G_DJL|T_SMLH, 
-  G_GU|0,       G_GA2L|0,     G_IL|T_SMLH,  G_DIL|0,      G_IL|0,       G_ML|T_VL,    G_TMWL|0,     G_MWHL|0,     
+  G_GU|0,       G_GA2L|0,     G_IL|T_SMLH,  G_DIL|0,      G_IL|0,       G_ML|T_VL,    G_TMWL|0,     G_ML|T_HK2,   
   G_NU|0,       G_OL|T_SMLH,  G_PHIL|0,     G_RU|0,       G_RU|T_VL,    G_UL|0,       G_TWL|0,      G_YL|0,       
   G_EZHL|0,     G_GSU|0,      G_WHIC|T_MDU, G_SCBLU|0,    G_HU|0,       G_LU|0,       
 ////////////////////////////////////////////////////////////////////////////////
@@ -449,10 +449,10 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Offsets in 2-90 are mapped.
 // This is a sparse block.  
   G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     G_SPAC|0,     
-  G_SPAC|0,     G_HYPH|0,     G_HYPH|0,     G_HYPH|0,     G_HYPH|0,     G_ED|0,       G_ED|0,       G_DOVL|0,     
+  G_SPAC|0,     G_HYPH|0,     G_HYPH|0,     G_HYPH|0,     G_HYPH|0,     G_HYPH|T_SMLFH,G_HYPH|T_SMLFH,G_DOVL|0,     
   G_APOS|0,     G_APOS|0,     G_COMM|0,     G_QUOM|0,     G_QUOM|0,     G_SPAC|T_DVLB,G_QUOM|0,     G_DAGG|0,     
   G_AC|0,       G_BULL|0,     G_FULS|0,     G_HORE|0,     G_SPAC|T_MDU, G_PMS|0,      G_PTTS|0,     G_SPAC|T_AA,  
-  G_GRAA|0,     G_LESS|0,     G_LESS|T_H5,  G_DOEM|0,     G_INT2|0,     G_PILS|T_H5,  G_COLO|0,     
+  G_GRAA|0,     G_LESS|0,     G_LESS|T_H5,  G_SR6L|T_TU,  G_INT2|0,     G_PILS|T_H5,  G_COLO|0,     
 ////////////////////////////////////////////////////////////////////////////////
 // Data for 0x000020A0-0x000020CF "Currency Symbols".
 // Offsets in 7-31 are mapped.
@@ -473,7 +473,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Data for 0x00002200-0x000022FF "Mathematical Operators".
 // Offsets in 0-255 are mapped.
 // This is a sparse block.  
-  G_AU|T_VU,    G_CU|0,       G_PARD|0,     G_EU|T_H5,    G_OL|T_DSL,   G_DELU|0,     G_NABL|0,     G_ELEO|0,     
+  G_AU|T_VU,    G_CU|0,       G_PARD|0,     G_EU|T_H5,    G_OL|T_DSL,   G_DELU|0,     G_NABL|0,     G_LUEM|T_SMLH,
   G_LUEM|0,     G_LUEM|T_H6,  G_EOP|0,      G_PIU|0,      G_ESHU|0,     G_HYPH|0,     G_PLU2|T_VU,  G_SOLI|0,     
   G_SOLI|T_H5,  G_ASTE|0,     G_RINO|0,     G_BULL|0,     G_SQUR|0,     G_INFI|0,     G_RIG2|0,     G_VERL|0,     
   G_DOVL|0,     G_VL|0,       G_ETSB|0,     G_UU|0,       G_INTE|0,     G_DOUI|0,     G_COLO|0,     G_ALET|0,     
@@ -483,7 +483,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Data for 0x00002300-0x000023FF "Miscellaneous Technical".
 // Offsets in 16-122 are mapped.
 // This is a sparse block.  
-  G_NOS|T_H6,   G_THI|0,      G_BOHI|0,     G_IOTL|0,     G_RHOL|0,     G_OMEL|0,     G_ALPL|T_LBLW,G_O2L|T_LBLW, 
+  G_NOS|T_H6,   G_BOHI|T_TU,  G_BOHI|0,     G_IOTL|0,     G_RHOL|0,     G_OMEL|0,     G_ALPL|T_LBLW,G_O2L|T_LBLW, 
   G_IOTL|T_LBLW,G_OMEL|T_LBLW,G_ALPL|0,     
 ////////////////////////////////////////////////////////////////////////////////
 // Data for 0x000025A0-0x000025FF "Geometric Shapes".
@@ -492,8 +492,8 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_EOP|0,      G_WHIS|0,     G_BLAR|0,     G_BLUT|0,     G_DELU|0,     G_BLUT|0,     G_DELU|0,     G_BLRT|0,     
   G_BLRT|T_OLN, G_BLRT|T_OLN, G_BLRT|0,     G_BLRT|T_OLN, G_BLUT|T_VU,  G_NABL|0,     G_BLUT|T_VU,  G_NABL|0,     
   G_BLRT|T_H5,  G_BLRT|T_H5,  G_BLAD|0,     G_BLAD|T_OLN, G_BLAD|0,     G_LOZE|0,     G_WHIC|0,     _COMB_|0,     
-  G_WHIC|0,     G_BLAC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     
-  G_RINO|0,     G_BLAC|0,     G_RINO|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     
+  G_WHIC|0,     G_MINI|T_DSM, G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     
+  G_RINO|0,     G_MINI|T_DSM, G_RINO|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     G_WHIC|0,     
   G_WHIS|0,     G_EOP|0,      G_WHIS|0,     G_EOP|0,      
 ////////////////////////////////////////////////////////////////////////////////
 // Data for 0x00002600-0x000026FF "Miscellaneous Symbols".
@@ -502,8 +502,8 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_BLAS|0,     G_WHIC|T_MDU, G_WHIS|0,     G_CHEM|T_TMB, G_MULS|T_TMB, G_ANKH|0,     G_ANKH|0,     G_ANKH|0,     
   G_ANKH|0,     G_CROJ|0,     G_BLSF|T_OLN, G_BLSF|0,     G_WSWR|0,     G_FEMS|0,     G_MALS|0,     G_BLSS|0,     
   G_BLHS|T_OLN, G_BLAD|T_OLN, G_BLCS|0,     G_BLSS|T_OLN, G_BLHS|0,     G_BLAD|0,     G_BLCS|T_OLN, G_QUAN|0,     
-  G_QUAN|0,     G_BE8N|0,     G_BE8N|0,     G_ANKH|0,     G_ANKH|0,     G_WHIC|0,     G_WHIC|0,     G_BLAC|0,     
-  G_BLAC|0,     G_WARS|0,     G_BLAC|0,     G_BLAC|0,     G_RINO|0,     G_NABL|0,     G_BLAS|0,     G_BLAS|0,     
+  G_QUAN|0,     G_BE8N|0,     G_BE8N|0,     G_ANKH|0,     G_ANKH|0,     G_WHIC|0,     G_WHIC|0,     G_MINI|T_DSM, 
+  G_MINI|T_DSM, G_WARS|0,     G_MINI|T_DSM, G_MINI|T_DSM, G_RINO|0,     G_NABL|0,     G_BLAS|0,     G_BLAS|0,     
   G_BLAS|0,     
 ////////////////////////////////////////////////////////////////////////////////
 // Data for 0x00002900-0x0000297F "Supplemental Arrows-B".
@@ -515,18 +515,12 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Data for 0x00002B00-0x00002BFF "Miscellaneous Symbols and Arrows".
 // Offsets in 1-239 are mapped.
 // This is a sparse block.  
-  G_NOWA|T_OLN, G_LERA|T_OLN, G_UPWA|T_BLD, G_NOWA|T_BLD, G_LERA|T_BLD, G_UDA|T_BLD,  G_BLAC|0,     G_BLAD|0,     
+  G_NOWA|T_OLN, G_LERA|T_OLN, G_UPWA|T_BLD, G_NOWA|T_BLD, G_LERA|T_BLD, G_UDA|T_BLD,  G_MINI|T_DSM, G_BLAD|0,     
   G_BLAD|T_OLN, G_BLAD|0,     G_RIDA|T_H5,  G_RIDA|T_H5,  G_RIOA|T_H5,  G_UPTA|0,     G_RIOA|0,     G_UPTA|T_VU,  
   G_RIDA|T_H5,  G_UPDA|0,     G_RIDA|0,     G_UPDA|T_VU,  G_UPTA|T_TMB, G_RIOA|T_TMB, G_UPTA|T_TMB, G_TTRA|T_H5,  
   G_TRUE|0,     G_TTRA|0,     G_TRUE|T_VU,  G_TTRA|T_H5,  G_TRUE|0,     G_TTRA|0,     G_TRUE|T_VU,  G_BLAD|0,     
   G_BLUT|0,     G_BLUT|T_VU,  G_BLRT|T_H5,  G_BLRT|0,     G_R2AW|T_H6,  G_D2AW|T_VU,  G_R2AW|0,     G_D2AW|0,     
 ////////////////////////////////////////////////////////////////////////////////
-// Data for 0x00002C60-0x00002C7F "Latin Extended-C".
-// Offsets in 3-22 are mapped.
-// This is a sparse block.  
-  G_PU|T_SULH,  G_HU|T_DS1,   G_HL|T_DS1,   G_KU|T_DS1,   G_KL|T_DS1,   G_ZU|T_DS1,   G_ZL|T_DS1,   G_MU|T_HK2,   
-  G_AU|T_VU,    G_WU|T_RHU,   G_HETU|0,     G_HETL|0,     
-////////////////////////////////////////////////////////////////////////////////
 // Data for 0x0000A640-0x0000A69F "Cyrillic Extended-B".
 // Offsets in 4-87 are mapped.
 // This is a sparse block.  
@@ -569,7 +563,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Offsets in 6-249 are mapped.
 // This is a sparse block.  
   G_WSWR|0,     G_SWCS|0,     G_SPEA|0,     G_SW1S|0,     G_SW3S|0,     G_LERA|T_TMB, G_RIGA|T_TMB, G_UPWA|T_TMB, 
-  G_BLAC|0,     G_BLAC|0,     G_LOZE|0,     G_LOZE|0,     G_BLAD|0,     G_BLAD|0,     G_BLUT|0,     G_BLUT|T_VU,  
+  G_MINI|T_DSM, G_MINI|T_DSM, G_LOZE|0,     G_LOZE|0,     G_BLAD|0,     G_BLAD|0,     G_BLUT|0,     G_BLUT|T_VU,  
   G_BLUT|T_TMB, G_WHIC|0,     G_WHIC|0,     G_CROJ|0,     G_CROJ|0,     G_CROJ|0,     G_ANKH|0,     G_ANKH|0,     
   G_ANKH|0,     G_SPEA|0,     G_SW1S|0,     G_SW3S|0,     G_TELR|0,     G_TELR|0,     G_TELR|0,     G_TELR|0,     
   G_TELR|0,     G_TELR|0,     G_TELR|0,     G_THUS|0,     G_THUS|T_VU,  G_WUPB|T_VU,  G_WRPB|T_H5,  G_WRPB|0,     
@@ -696,8 +690,8 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_AU|0,       G_BWTU|0,     G_BU|0,       G_GAMU|0,     G_DEU|0,      G_EU|0,       G_ZHEU|0,     G_DIG3|0,     
   G_PDU|0,      G_PDU|T_BA,   G_KU|0,       G_ELU|0,      G_MU|0,       G_HU|0,       G_OU|0,       G_PIU|0,      
   G_PU|0,       G_CU|0,       G_TU|0,       G_2U|0,       G_PHIU|0,     G_XU|0,       G_TSEU|0,     G_CHEU|0,     
-  G_SHAU|0,     G_SHCU|0,     G_HSU|0,      G_YERU|0,     G_S2U|0,      G_UIU|T_H5,   G_YUU|0,      G_RU|T_H5,    
-  G_AL|0,       G_BEL|0,      G_SCBLU|0,    G_GHEL|0,     G_DEL|0,      G_EL|0,       G_ZHEL|0,     G_O2L|T_H6,   
+  G_SHAU|0,     G_SHAU|T_DS1, G_HSU|0,      G_YERU|0,     G_S2U|0,      G_UIU|T_H5,   G_YUU|0,      G_RU|T_H5,    
+  G_AL|0,       G_RHSM|T_VL,  G_SCBLU|0,    G_GHEL|0,     G_DEL|0,      G_EL|0,       G_ZHEL|0,     G_O2L|T_H6,   
   G_PDL|0,      G_PDL|T_BA,   G_KRAL|0,     G_ELL|0,      G_TWL|0,      G_ENL|0,      G_OL|0,       G_PIL|0,      
   G_PL|0,       G_CL|0,       G_TEL|0,      G_YL|0,       G_PHIL|0,     G_XL|0,       G_TSEL|0,     G_CHEL|0,     
   G_SHAL|0,     G_SHCL|0,     G_HSL|0,      G_YERL|0,     G_S2L|0,      G_LUEM|T_H6,  G_YUL|0,      G_YAL|0,      
@@ -734,7 +728,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_SPAC|T_LHRA,G_SPAC|T_AA,  _COMB_|T_AEM, _COMB_|T_AEP, G_GRAA|0,     _COMB_|T_AQM, 0|0,          G_ML|0,       
   G_ML|T_VL,    G_BENL|0,     G_GIML|0,     G_DAL|0,      G_ECHL|0,     G_ZAL|0,      G_EHL|0,      G_ETL|0,      
   G_TOL|0,      G_GIMU|T_VU,  G_INIL|0,     G_LIWL|0,     G_XEHL|0,     G_CAL|0,      G_KENL|0,     G_HL|0,       
-  G_JAL|0,      G_GHAL|0,     G_CH2L|0,     G_MENL|0,     G_YIL|0,      G_NOWL|0,     G_SH2L|0,     G_NL|0,       
+  G_JAL|0,      G_NOWL|T_TL,  G_CH2L|0,     G_MENL|0,     G_YIL|0,      G_NOWL|0,     G_SH2L|0,     G_NL|0,       
   G_CHAL|0,     G_TMWL|0,     G_JHEL|0,     G_RAL|0,      G_UL|0,       G_VEWL|0,     G_TIWL|0,     G_NL|T_LDSC,  
   G_GL|0,       G_GHEL|T_VL,  G_PIWL|0,     G_KEHL|0,     G_OL|0,       G_FEHL|0,     G_EYL|0,      G_YIL|T_SMLH, 
   G_COLO|0,     G_HYPH|0,     0|0,          0|0,          G_WHIC|T_MDU, G_WHIC|T_MDU, G_ARDS|0,     
@@ -746,7 +740,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_E|T_DSE,    G_AA|T_DSCE,  G_AA|T_DSSR,  G_AA|T_DSE,   G_AA|T_DSAI,  G_KA|0,       G_KHA|0,      G_GA|0,       
   G_GHA|0,      G_NGA|0,      G_CA|0,       G_CHA|0,      G_JA|0,       G_JHA|0,      G_NYA|0,      G_TTA|0,      
   G_TTHA|0,     G_DDA|0,      G_DDHA|0,     G_NNA|0,      G_TA|0,       G_THA|0,      G_DA|0,       G_DHA|0,      
-  G_NA|0,       G_NA|T_DSNK,  G_PA|0,       G_PHA|0,      G_BA|0,       G_BHA|0,      G_MA|0,       G_YA|0,       
+  G_NA|0,       G_NA|T_DSNK,  G_PA|0,       G_PHA|0,      G_BA|0,       G_BHA|0,      G_GA|T_MDU,   G_YA|0,       
   G_RA|0,       G_RA|T_DSNK,  G_LA|0,       G_LLA|0,      G_LLA|T_DSNK, G_VA|0,       G_SHA|0,      G_SSA|0,      
   G_SA|0,       G_HA|0,       _COMB_|T_DSOE,G_DVSA|T_DSOE,_COMB_|T_DSNK,G_DESA|0,     G_DVSA|0,     0|0,          
   0|0,          _COMB_|T_DVSU,_COMB_|T_DSUU,_COMB_|T_DSVR,_COMB_|T_DSRR,_COMB_|T_DSCE,_COMB_|T_DSSR,_COMB_|T_DSE, 
@@ -793,10 +787,10 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // Offsets in 0-59 are mapped.  
   G_VF17|0,     G_VF1N|0,     G_VF1T|0,     G_VF12|0,     G_VF2T|0,     G_VF1F|0,     G_VF2F|0,     G_VF3F|0,     
   G_VF4F|0,     G_VF16|0,     G_VF56|0,     G_VF18|0,     G_VF38|0,     G_VF58|0,     G_VF78|0,     G_FRN1|0,     
-  G_DC|0,       G_LC|0,       G_RON3|0,     G_RON4|0,     G_VU|0,       G_RON6|0,     0|0,          0|0,          
-  G_RON9|0,     G_XU|0,       G_RONE|0,     0|0,          G_LU|0,       G_CU|0,       G_DU|0,       G_MU|0,       
-  G_IL|0,       G_SR6L|0,     G_SR5L|0,     G_SR3L|0,     G_VL|0,       G_SR4L|0,     0|0,          0|0,          
-  G_SR2L|0,     G_XL|0,       G_SRNL|0,     0|0,          G_LL|0,       G_CL|0,       G_DL|0,       G_ML|0,       
+  G_DC|0,       G_LC|0,       G_RON3|0,     G_RON4|0,     G_VU|0,       G_RON4|T_H5,  0|0,          0|0,          
+  G_RON9|0,     G_XU|0,       G_RON9|T_H5,  0|0,          G_LU|0,       G_CU|0,       G_DU|0,       G_MU|0,       
+  G_IL|0,       G_SR6L|0,     G_SR5L|0,     G_SR4L|T_H5,  G_VL|0,       G_SR4L|0,     0|0,          0|0,          
+  G_SR2L|0,     G_XL|0,       G_SR2L|T_H5,  0|0,          G_LL|0,       G_CL|0,       G_DL|0,       G_ML|0,       
   G_RN1T|0,     G_RN5T|0,     0|0,          G_CU|T_H5,    G_CL|T_H6,    G_CU|T_DS1,   G_YNU|T_VU,   G_RNFT|0,     
   0|0,          G_VF0T|0,     G_DIG2|T_TU,  G_DIG3|T_TU,  
 ////////////////////////////////////////////////////////////////////////////////
@@ -814,7 +808,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_TEAA|0,     G_TEAA|0,     G_TEAA|0,     G_TEAA|0,     G_MULS|0,     G_WHIC|0,     G_MULS|T_TMB, 0|0,          
   0|0,          0|0,          0|0,          G_QUEM|0,     G_QUEM|0,     G_EXCM|0,     G_BLAD|0,     G_EXCM|0,     
   G_DC|0,       G_DC|T_BLD,   0|0,          G_APOS|0,     G_APOS|0,     G_QUOM|0,     G_QUOM|0,     G_COMM|0,     
-  G_SPAC|T_DVLB,G_PILS|0,     G_HEMO|0,     G_HHEM|0,     G_BLHS|0,     G_RHBH|0,     G_RHBH|0,     G_RHBH|0,     
+  G_SPAC|T_DVLB,G_PILS|0,     G_HHEM|T_CDAL,G_HHEM|0,     G_BLHS|0,     G_RHBH|0,     G_RHBH|0,     G_RHBH|0,     
   G_LEFP|T_BLD, 0|0,          G_LEFP|T_VBD, 0|0,          G_MLAB|0,     0|0,          G_MLAB|T_BLD, 0|0,          
   G_MLAB|T_VBD, 0|0,          G_LESB|T_BLD, 0|0,          G_LECB|T_BLD, 0|0,          G_DIG1|T_TMB, G_DIG2|T_TMB, 
   G_DIG3|T_TMB, G_DIG4|T_TMB, G_DIG5|T_TMB, G_DIG6|T_TMB, G_DIG7|T_TMB, G_DIG8|T_TMB, G_DIG9|T_TMB, G_NTFS|T_TMB, 
@@ -826,6 +820,12 @@ static const unsigned int codepoint_map[] PROGMEM = {
   0|0,          0|0,          0|0,          0|0,          0|0,          0|0,          0|0,          0|0,          
   0|0,          0|0,          G_RIOA|T_TMB, 
 ////////////////////////////////////////////////////////////////////////////////
+// Data for 0x00002C60-0x00002C7F "Latin Extended-C".
+// Offsets in 3-22 are mapped.  
+  G_PU|T_SULH,  0|0,          0|0,          0|0,          G_HU|T_DS1,   G_HL|T_DS1,   G_KU|T_DS1,   G_KL|T_DS1,   
+  G_ZU|T_DS1,   G_ZL|T_DS1,   0|0,          G_MU|T_HK2,   G_AU|T_VU,    0|0,          0|0,          G_WU|T_RHU,   
+  0|0,          0|0,          G_HETU|0,     G_HETL|0,     
+////////////////////////////////////////////////////////////////////////////////
 // Data for 0x00003040-0x0000309F "Hiragana".
 // Offsets in 1-95 are mapped.  
   G_S8L|0,      G_6|0,        G_S9L|0,      G_7|0,        G_SBL|0,      G_8|0,        G_SCL|0,      G_9|0,        
@@ -833,7 +833,7 @@ static const unsigned int codepoint_map[] PROGMEM = {
   G_K7|0,       G_K7|T_VSM,   G_K8|0,       G_K8|T_VSM,   G_S4|0,       G_S4|T_VSM,   G_S5|0,       G_S5|T_VSM,   
   G_S6|0,       G_S6|T_VSM,   G_S7|0,       G_S7|T_VSM,   G_S8|0,       G_S8|T_VSM,   G_T4|0,       G_T4|T_VSM,   
   G_T5|0,       G_T5|T_VSM,   G_SFL|0,      G_T6|0,       G_T6|T_VSM,   G_T7|0,       G_T7|T_VSM,   G_T8|0,       
-  G_T8|T_VSM,   G_N4|0,       G_N5|0,       G_N6|0,       G_N7|0,       G_N8|0,       G_H5|0,       G_H5|T_VSM,   
+  G_T8|T_VSM,   G_N4|0,       G_N5|0,       G_M8|T_ONM,   G_N7|0,       G_N8|0,       G_H5|0,       G_H5|T_VSM,   
   G_H5|T_SVSM,  G_H6|0,       G_H6|T_VSM,   G_H6|T_SVSM,  G_H7|0,       G_H7|T_VSM,   G_H7|T_SVSM,  G_H4|0,       
   G_H4|T_VSM,   G_H4|T_SVSM,  G_H8|0,       G_H8|T_VSM,   G_H8|T_SVSM,  G_M5|0,       G_M6|0,       G_M7|0,       
   G_M8|0,       G_M9|0,       G_SGL|0,      G_Y4|0,       G_SHL|0,      G_Y5|0,       G_SJL|0,      G_Y6|0,       
@@ -889,27 +889,27 @@ static const unsigned int codepoint_map[] PROGMEM = {
 // 11 Miscellaneous Symbols (sparse)
 // 12 Supplemental Arrows-B (sparse)
 // 13 Miscellaneous Symbols and Arrows (sparse)
-// 14 Latin Extended-C (sparse)
-// 15 Cyrillic Extended-B (sparse)
-// 16 Latin Extended-D (sparse)
-// 17 Latin Extended-E (sparse)
-// 18 Miscellaneous Symbols and Pictographs1 (sparse)
-// 19 Miscellaneous Symbols and Pictographs2 (sparse)
-// 20 Miscellaneous Symbols and Pictographs3 (sparse)
-// 21 Supplemental Arrows-C (sparse)
-// 22 Basic Latin 
-// 23 Latin-1 Supplement 
-// 24 Latin Extended-A 
-// 25 Latin Extended-B 
-// 26 Greek and Coptic 
-// 27 Cyrillic 
-// 28 Armenian 
-// 29 Devanagari 
-// 30 Georgian 
-// 31 Superscripts and Subscripts 
-// 32 Letterlike Symbols 
-// 33 Number Forms 
-// 34 Dingbats 
+// 14 Cyrillic Extended-B (sparse)
+// 15 Latin Extended-D (sparse)
+// 16 Latin Extended-E (sparse)
+// 17 Miscellaneous Symbols and Pictographs1 (sparse)
+// 18 Miscellaneous Symbols and Pictographs2 (sparse)
+// 19 Miscellaneous Symbols and Pictographs3 (sparse)
+// 20 Supplemental Arrows-C (sparse)
+// 21 Basic Latin 
+// 22 Latin-1 Supplement 
+// 23 Latin Extended-A 
+// 24 Latin Extended-B 
+// 25 Greek and Coptic 
+// 26 Cyrillic 
+// 27 Armenian 
+// 28 Devanagari 
+// 29 Georgian 
+// 30 Superscripts and Subscripts 
+// 31 Letterlike Symbols 
+// 32 Number Forms 
+// 33 Dingbats 
+// 34 Latin Extended-C 
 // 35 Hiragana 
 // 36 Katakana 
 // 37 Katakana Phonetic Extensions 
@@ -918,18 +918,18 @@ static const unsigned int codepoint_map[] PROGMEM = {
 
 // Starting offset into codepoint_map for each included block:
 static const unsigned int bstart_indecies[] PROGMEM = {  0, 30, 49, 65,223,228,
-267,280,328,374,385,429,470,484,524,536,561,611,616,622,656,728,786,881,977,
-1105,1313,1456,1710,1805,1933,2004,2035,2107,2167,2346,2441,2537,2542,2590,};
+267,280,328,374,385,429,470,484,524,549,599,604,610,644,716,774,869,965,1093,
+1301,1444,1698,1793,1921,1992,2023,2095,2155,2334,2354,2449,2545,2550,2598,};
 
 // Within each included block, offset to first mapped codepoint:
 static const byte first_offsets[] PROGMEM = {  1,  9,  0,  2,189,  2,  7,  0,
-  0, 16,  0,  5, 12,  1,  3,  4,  6,  2,148, 70,  6,  5, 32, 32,  0,  0,  0,  0,
-  1,  0, 25,  0,  2,  0,  0,  1,  0,  2,  0,  0,};
+  0, 16,  0,  5, 12,  1,  4,  6,  2,148, 70,  6,  5, 32, 32,  0,  0,  0,  0,  1,
+  0, 25,  0,  2,  0,  0,  3,  1,  0,  2,  0,  0,};
 
 // Within each included block, offset to last mapped codepoint:
 static const byte last_offsets[] PROGMEM = { 79, 72, 47,255,254, 90, 31,110,255,
-122, 94,230, 77,239, 22, 87,221, 42,246,222,249,147,126,127,127,207,142,253, 95,
-127, 95, 30, 73, 59,178, 95, 95,  6, 47,  6,};
+122, 94,230, 77,239, 87,221, 42,246,222,249,147,126,127,127,207,142,253, 95,127,
+ 95, 30, 73, 59,178, 22, 95, 95,  6, 47,  6,};
 
 // List which codepoints (relative to start of block) sparse blocks contain:
 static const byte sparse_indecies[] PROGMEM = {  1,  2,  4,  8,  9, 11, 12, 15,
@@ -958,28 +958,28 @@ static const byte sparse_indecies[] PROGMEM = {  1,  2,  4,  8,  9, 11, 12, 15,
 100,101,102,103,105,106,107,108,112,113,134,135,136,137,160,170,171,172,219,228,
 229,230, 12, 13, 14, 15, 16, 17, 43, 44, 64, 65, 74, 75, 76, 77,  1,  4,  6,  9,
  12, 13, 36, 37, 38, 41, 55, 56, 96, 97, 98, 99,106,107,108,109,137,138,139,152,
-153,154,155,156,157,158,159,193,197,198,199,200,236,237,238,239,  3,  7,  8,  9,
- 10, 11, 12, 14, 15, 18, 21, 22,  4,  5,  7, 10, 11, 12, 13, 22, 23, 28, 30, 40,
- 41, 42, 43, 44, 45, 46, 62, 64, 65, 66, 67, 86, 87,  6,  7,  9, 11, 17, 32, 33,
- 34, 35, 40, 41, 42, 43, 46, 47, 78, 79, 80, 88, 96, 99,101,104,105,106,107,108,
-109,111,112,113,116,117,120,127,139,144,145,146,147,148,149,150,151,164,166,218,
-219,220,221,  2, 13, 30, 34, 42,148,156,157,167,245,246, 70, 71, 72, 73, 77, 78,
-123,126,128,137,142,147,148,149,150,151,152,153,154,155,156,157,158,159,160,178,
-180,185,189,190,191,192,199,222,  6,  7,  8,  9, 10, 27, 28, 29, 52, 53, 54, 55,
- 56, 57, 58, 59, 60, 62, 63, 64, 65, 66, 70, 71, 72,104,105,106,123,124,125,126,
-127,128,129,146,147,151,152,153,154,155,156,157,158,159,160,161,162,163,164,170,
-171,172,197,198,199,200,201,202,203,204,205,206,207,208,209,210,244,245,246,249,
-  5,  6,  9, 10, 20, 21, 22, 23, 25, 26, 29, 30, 36, 37, 38, 39, 41, 42, 45, 46,
- 49, 50, 56, 57, 58, 59, 61, 63, 64, 65, 66, 67, 68, 69, 70, 71, 80, 81, 82, 83,
- 84, 85, 86, 87, 88, 89,104,108,109,110,111,118,126,134,144,145,146,147,};
+153,154,155,156,157,158,159,193,197,198,199,200,236,237,238,239,  4,  5,  7, 10,
+ 11, 12, 13, 22, 23, 28, 30, 40, 41, 42, 43, 44, 45, 46, 62, 64, 65, 66, 67, 86,
+ 87,  6,  7,  9, 11, 17, 32, 33, 34, 35, 40, 41, 42, 43, 46, 47, 78, 79, 80, 88,
+ 96, 99,101,104,105,106,107,108,109,111,112,113,116,117,120,127,139,144,145,146,
+147,148,149,150,151,164,166,218,219,220,221,  2, 13, 30, 34, 42,148,156,157,167,
+245,246, 70, 71, 72, 73, 77, 78,123,126,128,137,142,147,148,149,150,151,152,153,
+154,155,156,157,158,159,160,178,180,185,189,190,191,192,199,222,  6,  7,  8,  9,
+ 10, 27, 28, 29, 52, 53, 54, 55, 56, 57, 58, 59, 60, 62, 63, 64, 65, 66, 70, 71,
+ 72,104,105,106,123,124,125,126,127,128,129,146,147,151,152,153,154,155,156,157,
+158,159,160,161,162,163,164,170,171,172,197,198,199,200,201,202,203,204,205,206,
+207,208,209,210,244,245,246,249,  5,  6,  9, 10, 20, 21, 22, 23, 25, 26, 29, 30,
+ 36, 37, 38, 39, 41, 42, 45, 46, 49, 50, 56, 57, 58, 59, 61, 63, 64, 65, 66, 67,
+ 68, 69, 70, 71, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,104,108,109,110,111,118,
+126,134,144,145,146,147,};
 
 // Where does included-codepoint list start within sparse_indecies?
 static const unsigned int sparse_offsets[] PROGMEM = {  0, 30, 49, 65,223,228,
-267,280,328,374,385,429,470,484,524,536,561,611,616,622,656,728,};
+267,280,328,374,385,429,470,484,524,549,599,604,610,644,716,};
 
 // For sparse blocks, how many glyphs are included?
 static const byte sparse_nmapped[] PROGMEM = { 30, 19, 16,158,  5, 39, 13, 48,
- 46, 11, 44, 41, 14, 40, 12, 25, 50,  5,  6, 34, 72, 58,};
+ 46, 11, 44, 41, 14, 40, 25, 50,  5,  6, 34, 72, 58,};
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -1001,234 +1001,231 @@ static const byte sparse_nmapped[] PROGMEM = { 30, 19, 16,158,  5, 39, 13, 48,
 // `group_rowstart`, `group_nrow`, `group_colstart`, `group_ncol` indicate
 // where within the 6x12 character the glyph bitmap should be drawn. (Most glyph
 // bitmaps do not store the full 6x12 image, there is a lot of empty space.)
-#define NGLYPHS (806)
-#define NGROUPS (32)
+#define NGLYPHS (788)
+#define NGROUPS (31)
 static const byte bitmap_data[] PROGMEM = { 14, 27, 31, 27, 27, 23, 21, 27, 14,
- 31,  8,  4,  5,  2,  5,223, 49, 62, 48,207,249,132,252,196,185, 26, 26, 26, 58,
-215,157,163,163,163,156,120,128,112, 12,247,158, 81, 81, 49, 49,168, 41, 41, 86,
-198,248, 37, 66,133,248,193, 80,208, 30,193,254, 33, 39, 37, 54,201, 37, 35, 37,
-201,190,133,153,133,185, 24, 56, 90,157, 24,175,147,147,147,237, 75, 72, 72, 72,
-120,142,145,145,137,254, 57,212,212, 68,171, 21,186,232,165, 63, 93, 66, 78, 66,
-221,168,168,112,168,171, 43, 42,234, 42, 46, 17, 17, 17,145,253,120, 88, 63, 24,
- 24,  9, 21, 21, 19, 51, 46, 48,254, 49, 49, 49,254,144, 16, 57, 70, 70, 70,185,
- 17, 18, 82,182, 21, 21, 24,224, 32, 35, 35, 35, 39,219,120,129,129,113, 33, 65,
-249, 32, 36,228, 38, 42, 49,209, 32, 32, 25,134,134,134, 57, 18,162,167, 74,170,
-170, 23,157,  2, 30, 34, 34, 34, 29,  1,  2,  2,  2,  2,  2,  2,196, 32, 36,164,
- 36, 36,196,253, 18, 18, 18, 18,146, 29,239, 17,  2,228,  8, 24,231,208, 17, 63,
- 18,213, 89,208,115,140,140,124, 11, 16, 99,194, 36, 36,200, 40, 48,223, 25, 34,
- 66,249, 70, 70, 57, 32,  4, 35, 32, 67,132,112,226, 98, 92,212, 84, 72,200,227,
- 20, 12, 11, 12, 20,227,231, 41, 49,241, 49, 41,231,  7,132,132,255,132,132,127,
- 31, 24, 24,252, 16, 24, 23,191, 73, 73,  9,  9,  9, 63,139, 76, 44, 28, 44, 76,
-140, 62, 34, 34,162, 98, 98, 34, 70,230,230,214,207,207, 70, 23, 24, 24,248, 24,
- 24,247,162, 98, 18,158, 99, 99,158, 35, 36, 36, 35, 32, 36,251,142,145, 81, 81,
- 81, 49, 49,168, 40,125, 85, 85, 86,198, 72, 69, 69, 66,165,165, 24, 62,  2,132,
- 72,144, 32, 63,  0,117,  2, 33,114, 37,  0,253, 37, 39,253, 37, 38,254, 57,198,
-198,253,192,192, 59,247, 40, 72,143, 72, 40,247, 29, 34, 32, 16,  8, 16, 63,217,
-105,105,105,169,169,217, 59, 37, 77, 85, 93,133,131,198,206,205,213,229,228,196,
-240, 16, 16,160,160, 64, 79,127, 65, 65, 92, 64, 64,254, 36,116,172,172,172,116,
- 39,100, 68, 46, 53, 53, 53,213, 71, 41, 42, 50, 18, 18,141,226, 50, 18,242, 26,
- 61,224,107,170,170,156,156,170,171, 28, 52, 36,116, 84, 84,143,240,176,176,254,
- 49, 49, 49, 62,198,198,190,134,134,  6, 69,170,170,168,152,152,149,  2,  2,158,
- 66, 82, 82,141,194, 66, 71, 74, 74, 74, 49,169,202,206,169,202,235,220, 50, 74,
- 74,146, 18, 34,  3,  0, 66,130,250,135, 66,  0,  0, 32,146, 75,134, 94,  0,128,
-129,162,149,251, 21, 33,  4,206, 53, 36,164,148,156,  0, 17, 18,150, 26, 17,  3,
-  0, 66,128, 90,133, 66,  0,128, 72, 88,127,152,  8,128, 33, 34, 82, 82,139,138,
-249, 63,160,163,172,176,172, 35,201,202,202,202,202,202,237,222, 18, 20,152, 24,
- 24,214, 98, 99, 99,126,107,115, 98, 75,172,172,172,107, 41,207,165,165,165,169,
-177,177,189,183,198,230, 87, 86, 86,167,  5,250,234,235, 75, 75,  5,  0,  3,142,
-126,142,  2,  0,  0,113,138,140,138,113,  0, 14,155,245,255,213,223, 14,  0, 16,
-127,255,253, 57, 16, 32, 50, 85, 72,138,133,  0,  0,  2,140,252, 12,  2,  1,  0,
- 33, 96,175, 50, 33,  0,  0, 36,196,223,142,132,  0, 16, 58,125, 17,184,124,  0,
-  2, 50,114,114,250, 55,  2,  0, 30,254,254,253,  4,  4,  0,113,115,255,115, 33,
-  0,  0,224, 14,159, 78, 36,  0,  0,  3,  3,  2,  2,  2,  0,  4,132,142,145,145,
-145,145,241, 14,  0,  0,  0,  0,  0,  0,  0,  3,  0,228, 47, 52, 44,230, 37, 62,
- 36,121, 70, 70, 70,249, 64, 64, 64, 17, 17, 17, 49,215, 17, 17, 22,127, 73,201,
- 73, 76, 64, 64, 72,196, 34, 33, 33, 34, 32, 32, 56,142,130,130,130,207,162,162,
-194, 10,138,138,138, 14, 10, 10, 51,239, 82, 86, 90,239, 66, 66, 66,140, 83, 83,
- 83,204, 70, 66,140, 97,146,146,202,163,146,146, 97,206, 49, 49, 49,222, 16, 18,
- 13, 57, 70,198,166,139, 10, 18, 34,224,231,248,250,236,239, 68, 66,  0,  0,  1,
-  1,  0,  0,  0,  0, 32, 36, 68, 66,130,130,  2,  2,  4,  4,128, 24,  8,  8,  8,
-  8,137,  9, 10, 26,  1,194, 66, 66, 66, 50, 67, 64, 64,194,  2,  4,132, 68, 68,
- 92,132,  4,  4, 24,  1,  9,107,141,141, 77, 43, 73, 73, 49,  8,  8,198, 33, 33,
-193, 65, 34, 44,207, 17, 17, 56,212, 84, 84, 84,144, 16, 17,  0, 18, 23, 42,162,
-194, 66,202,167, 34,  0,  8,  9, 31, 30, 62, 30, 30,  8,  9, 14, 17, 14, 14, 31,
- 31, 31, 30, 14,  2,  2,  8,  6,  1,110,129,  1,  0, 32,207, 56,132,133,137, 17,
-188,  7,  4,132,156,109, 69,197, 25, 16,  8,  4,194,143, 84, 36, 36, 68,127, 98,
-132,  8, 16,178,177,132,132, 37, 30,  6,  6,232, 24, 25,121,149, 21,198,  8, 16,
- 32, 96,254,120, 33, 34,100,132,255,  3,  4,  8, 15,  8, 15, 24, 16,  8,132,148,
- 20,255,130, 66,171,170,102, 66,255, 67, 66, 83, 90, 83, 82,255,160, 32, 44,170,
-186, 32,255,195,164, 35, 32,199,  4,255, 65, 66, 81,120, 65, 65,255,  8, 40,172,
-154, 10, 10,255,136, 75, 76,233, 42, 11,255,  0, 80,168,168, 81, 65,255,  0,128,
- 18,255, 18,128,  0,  0,130,245, 11,245,130,  0,  0, 36,109,254,109, 36,  0,  4,
- 12, 31, 63, 31, 12,  4,167, 40, 40, 73, 70,224,143,121,  5, 33,125,145,124, 10,
- 80,148,146,145,208,145,146,156, 66, 80, 80,127, 72, 72, 33, 66,116, 80, 96,248,
- 64,142, 65, 77,233, 74,159,234,117, 20,  4,233,  8,188,  9,227, 20, 20, 99,145,
- 23, 18,154, 22,122,146,146, 58,146, 33, 93,239, 73,232, 73,233, 36, 72, 80,145,
-145,255,132,161, 46,114, 18,158,107,  8, 33, 66,132,136,152,239, 66,196,  8, 16,
-148, 84, 63,148,224, 17, 82,148,252, 17, 16, 35, 84,136,148,241,158,196,132,  8,
-144, 16,127,128, 57,129,130,250,167,162,255,130,  0,  0,  1,  0,  0,  1,  0,  4,
-  4,  2,  2,  2,  1,  1,  2,  2,  2,  4,  4,  0,138,138,138,  0, 56,128,  0,  0,
-  0,  0,  8, 37, 18,  0,146,108, 64,128,  0, 57, 10, 18, 33, 24, 67, 68, 67, 68,
- 99,  0,136, 28,136,  0, 32, 83, 80, 83, 32,  2,  2,194, 64, 66, 25, 33, 57,  9,
- 57, 38, 73, 71,129,230, 28, 20, 28,148, 28,  3,  4,119,  4,  3, 68,130,130,130,
- 68,  0, 40, 40, 24,  0,  0,  1, 66,  2,  0,124,  0,128,  0,  0, 32, 80, 90, 80,
+238,  0,128,  3,  1,  0,  5,  2,  5,223, 49, 62, 48,207,249,132,252,196,185, 26,
+ 26, 26, 58,215,157,163,163,163,156,120,128,112, 12,247,158, 81, 81, 49, 49,168,
+ 41, 41, 86,198,248, 37, 66,133,248,193, 80,208, 30,193,254, 33, 39, 37, 54,201,
+ 37, 35, 37,201,190,133,153,133,185, 24, 56, 90,157, 24,175,147,147,147,237, 75,
+ 72, 72, 72,120,142,145,145,137,254, 57,212,212, 68,171, 21,186,232,165, 63, 93,
+ 66, 78, 66,221,168,168,112,168,171, 43, 42,234, 42, 46, 17, 17, 17,145,253,120,
+ 88, 63, 24, 24,  9, 21, 21, 19, 51, 46, 48,254, 49, 49, 49,254,144, 16, 57, 70,
+ 70, 70,185, 17, 18, 82,182, 21, 21, 24,224, 32, 35, 35, 35, 39,219,120,129,129,
+113, 33, 65,249, 32, 36,228, 38, 42, 49,209, 32, 32, 25,134,134,134, 57, 18,162,
+167, 74,170,170, 23,157,  2, 30, 34, 34, 34, 29,  1,  2,  2,  2,  2,  2,  2,196,
+ 32, 36,164, 36, 36,196,253, 18, 18, 18, 18,146, 29,239, 17,  2,228,  8, 24,231,
+208, 17, 63, 18,213, 89,208,115,140,140,124, 11, 16, 99,194, 36, 36,200, 40, 48,
+223, 25, 34, 66,249, 70, 70, 57, 32,  4, 35, 32, 67,132,112,226, 98, 92,212, 84,
+ 72,200,227, 20, 12, 11, 12, 20,227,231, 41, 49,241, 49, 41,231,  7,132,132,255,
+132,132,127, 31, 24, 24,252, 16, 24, 23,191, 73, 73,  9,  9,  9, 63,139, 76, 44,
+ 28, 44, 76,140, 62, 34, 34,162, 98, 98, 34, 70,230,230,214,207,207, 70, 23, 24,
+ 24,248, 24, 24,247,162, 98, 18,158, 99, 99,158, 35, 36, 36, 35, 32, 36,251,142,
+145, 81, 81, 81, 49, 49,168, 40,125, 85, 85, 86,198, 72, 69, 69, 66,165,165, 24,
+ 62,  2,132, 72,144, 32, 63,  0,117,  2, 33,114, 37,  0,253, 37, 39,253, 37, 38,
+254, 57,198,198,253,192,192, 59,247, 40, 72,143, 72, 40,247, 29, 34, 32, 16,  8,
+ 16, 63,217,105,105,105,169,169,217, 59, 37, 77, 85, 93,133,131,198,206,205,213,
+229,228,196,240, 16, 16,160,160, 64, 79,127, 65, 65, 92, 64, 64,254, 36,116,172,
+172,172,116, 39,100, 68, 46, 53, 53, 53,213, 71, 41, 42, 50, 18, 18,141,226, 50,
+ 18,242, 26, 61,224,107,170,170,156,156,170,171, 28, 52, 36,116, 84, 84,143,240,
+176,176,190,177,177,177,223,214,214,222,198,198,198,167, 88, 88, 23, 16, 16,160,
+ 72, 85,213, 85, 83, 83,178, 64, 64,243, 72, 74, 74, 49,152, 72, 72, 73, 73, 73,
+102,167, 42, 58,166, 42,172,112,202, 43, 43, 74, 75,139, 15, 82, 83,123,106,106,
+106,106, 85, 85, 82, 82, 82,  5, 85,178,178, 53,181,181,  0, 48,  2, 18, 17,214,
+ 58, 16,  0,  0,  2,148, 95, 52,242,  0,  0,  9, 20,170,220,170,  8, 36,116,173,
+ 36, 39,160,225,  0,142,145,177,213,140, 28,  0, 16,  0,212, 40, 16,  0,  0, 66,
+196,250,196, 66,  0, 12, 18,146,147, 92, 80,204,249,  1, 26, 98,132,100, 31, 73,
+ 85, 85, 85, 85, 85,105,246,150,166,198,198,198,183, 22, 24, 24,244, 88,152, 22,
+ 91, 99, 99, 99, 91, 75,123, 42, 45, 45, 77,139,137,238,189, 53, 53,189,181,181,
+ 61, 45,214, 87, 90, 90, 90, 45,  0, 31,119,247,114, 18,  0,  0,136, 84, 99, 84,
+136,  0,112,219,172,252,172,251,112,  0,132,255,255,238,206,128,  0,144,171, 71,
+ 87, 41,  0,  1, 17, 98,226,100, 20,  8,  0,  8,  4,127,144,  8,  0,  0, 33, 35,
+253,113, 33,  0,128,209,238,142,196,228,  0, 16,145,147,144,213,187, 16,  0,241,
+243,243,239, 33, 32,  0, 28,255,247,251, 28,  0,  0,113,115,255,115, 33,  0,  0,
+224, 14,159, 78, 36,  0,  0,  3,  3,  2,  2,  2,  0,  4,132,142,145,145,145,145,
+241, 14,  0,  0,  0,  0,  0,  0,  0,  3,  0,228, 47, 52, 44,230, 37, 62, 36,121,
+ 70, 70, 70,249, 64, 64, 64, 17, 17, 17, 49,215, 17, 17, 22,127, 73,201, 73, 76,
+ 64, 64, 72,196, 34, 33, 33, 34, 32, 32, 56,142,130,130,130,207,162,162,194, 10,
+138,138,138, 14, 10, 10, 51,239, 82, 86, 90,239, 66, 66, 66,140, 83, 83, 83,204,
+ 70, 66,140, 97,146,146,202,163,146,146, 97,206, 49, 49, 49,222, 16, 18, 13, 57,
+ 70,198,166,139, 10, 18, 34,224,231,248,250,236,239, 68, 66,  0,  0,  1,  1,  0,
+  0,  0,  0, 32, 36, 68, 66,130,130,  2,  2,  4,  4,128, 24,  8,  8,  8,  8,137,
+  9, 10, 26,  1,194, 66, 66, 66, 50, 67, 64, 64,194,  2,  4,132, 68, 68, 92,132,
+  4,  4, 24,  1,  9,107,141,141, 77, 43, 73, 73, 49,  8,  8,198, 33, 33,193, 65,
+ 34, 44,207, 17, 17, 56,212, 84, 84, 84,144, 16, 17,  0, 18, 23, 42,162,194, 66,
+202,167, 34,  0, 28, 29,201,192,200,220,254, 62, 21,  0,  1,  1,  3,  3,  7,  3,
+  3,  1,  1, 14, 17, 14, 14, 31, 31, 31, 30, 14,  2,  2,  8,  6,  1,110,129,  1,
+  0, 32,207, 56,132,133,137, 17,188,  7,  4,132,156,109, 69,197, 25, 16,  8,  4,
+194,143, 84, 36, 36, 68,127, 98,132,  8, 16,178,177,132,132, 37, 30,  6,  6,232,
+ 24, 25,121,149, 21,198,  8, 16, 32, 96,254,120, 33, 34,100,132,255,  3,  4,  8,
+ 15,  8, 15, 24, 16,  8,132,148, 20,255,130, 66,171,170,102, 66,255, 67, 66, 83,
+ 90, 83, 82,255,160, 32, 44,170,186, 32,255,195,164, 35, 32,199,  4,255, 65, 66,
+ 81,120, 65, 65,255,  8, 40,172,154, 10, 10,255,136, 75, 76,233, 42, 11,255,  0,
+ 80,168,168, 81, 65,255,  0,128, 18,255, 18,128,  0,  0,130,245, 11,245,130,  0,
+  0, 36,109,254,109, 36,  0,  4, 12, 31, 63, 31, 12,  4,167, 40, 40, 73, 70,224,
+143,121,  5, 33,125,145,124, 10, 80,148,146,145,208,145,146,156, 66, 80, 80,127,
+ 72, 72, 33, 66,116, 80, 96,248, 64,142, 65, 77,233, 74,159,234,117, 20,  4,233,
+  8,188,  9,227, 20, 20, 99,145, 23, 18,154, 22,122,146,146, 58,146, 33, 93,239,
+ 73,232, 73,233,138, 19, 21, 55, 46,229,132, 36,201, 74, 82,210,127, 16, 52, 69,
+142,  2, 19,237, 65,132,  8, 16,145,147,253,136, 24, 33, 66,146,138, 39, 18,124,
+130, 10,146, 63,194,130,132, 10, 17, 18,254, 19, 56, 48, 65, 82,226, 79,240, 71,
+ 16, 16, 63, 20, 20, 63, 16,  0,  0,  6,  5,  5,132,132,  4,  4,  4,  4,  4,  2,
+  2,  1,  1,  1,  0,  0,  1,  1,  1,  2,  2,  0,138,138,138,  0,  0, 68, 40,144,
+  0,144, 96,  1,  0,  0,204, 83,146, 12,192, 25, 32, 24, 33, 24,  2, 66,226, 66,
+  3,  0,156,128,156,  0, 17, 18, 18,  2, 17,200,  8,206, 74,202, 48, 73, 57,  8,
+ 49,225,162,226,164,231, 24, 32,184, 36, 24, 32, 16, 19, 16, 32,  2, 68, 68,196,
+  2,  0,  1,  1,  0,  0,  0,  1, 66,  2,  0,124,  0,128,  0,  0, 32, 80, 90, 80,
  32,196, 68,132,  4,198, 25, 32, 24, 33, 24,100,132,231, 37,229,152, 36, 28,  4,
 152,112, 81,113, 82,115, 12,144,220,146, 12,  0,  0, 57,  0,  0, 64, 39, 32, 39,
- 64,  4,  8,136,136,132,  0,  0,  3,  2,  3,207,192,207,237,213,237, 15, 15, 15,
-251, 37,253, 53,251,133,  6,125,134,133,255, 88, 91, 84, 91,253,101,221, 69, 71,
-235,170,185,168,232, 49, 82, 95, 81,222,247,215,191,149,149, 92,242,167,162, 76,
-123,251,174,106,210,237,254, 90,156,239, 46,213, 49,149, 78,101,164,198,205,182,
-235, 26, 26,138, 70,148, 99, 99, 98,156,114, 12,125, 13,114,221, 55,121, 49,205,
- 41, 86, 87, 86, 41,  1,  1,  1,  1,  7,198, 72,144,140, 80, 50, 44, 64, 65,249,
-212,213,214,214,252,  8,234, 90, 90, 26,167, 32,161,189, 35, 35, 99,164, 32, 35,
- 36,169,250, 36,  3,  0, 17,255, 41, 41, 41, 47,  0, 66,255,213,213,213,213, 64,
-130,239,216, 88, 88,104,  8, 16,146, 82, 79, 67,159, 10,  9,123, 13, 75, 72, 59,
-  8,  8, 30, 41, 41, 41,238,225,161,187,165,165,165,184, 23, 16,212, 84,148, 20,
-227, 28,  4, 68, 69, 69, 69,196,254, 10, 18, 34, 66, 66, 57,255, 33, 66,196, 62,
- 34,196,  9,252,136, 56, 73,201, 56,135,120,168, 87, 84, 84,227,156, 98, 98, 33,
- 97, 99,156,  3, 68,148,170,172,172,115, 14,241, 81, 40, 48, 48,200, 57,196,192,
- 78, 82, 82,253,231,  8, 40,216, 90, 90,237,144, 79,  5,162,107,107,148,115,140,
-143, 76,140,140, 76,202, 36, 10,145, 17, 49,238,185, 10, 58, 69,198,198,187,225,
- 34, 68,  4,244, 84, 84,  0,  1,  1,  1,  1,  1,  1,202, 42, 63,170,223, 74,202,
-  2, 17, 87,186, 84, 16,  1,  0, 34,  2, 15,  2, 34,  0,196,132,128,192,128,132,
-  0,  7,136,112, 83,112,136,  7,  4,228, 31,228, 59, 74,241,128,189,128,153,165,
-165,152,  0, 71,  8,232,  8, 71,  0,154, 98, 98, 98, 98, 98,162, 55, 81, 33, 87,
- 81,137,143,106, 42, 42, 42, 42, 42, 42,185,198,198,186,198,198,199, 64, 64, 64,
- 79, 80, 80,240,112,146,166,170,179,165,135,238,174,174,126, 42, 42, 43,242,178,
-178,174,162,162,175,187,202,202,186,138,138,142,228, 26, 26, 27,250, 26,228,114,
- 75,203,159,138, 10, 50,237,237,239,186,170, 73, 73,181,245,127,106, 42,113,191,
-187,215,197,197,198, 86, 59, 96,144,208,144,159,152,144,209,208, 48, 16, 18, 82,
-140,123,  8,  9, 10,250, 10,  9, 47,161,161,161, 41, 41,198,133,134,198,207,182,
-134,133,228, 26, 26, 26,171,112,208, 32,161,109,179, 34, 34,  3,182, 73,112,128,
-139,142,114,222, 49, 49, 42, 38, 38, 57, 56,197,193,189, 65, 73,179,199,120,128,
-  0, 25, 22,225,224, 96, 40,169,107,107,156, 79, 75,203, 76, 76, 76, 51,216, 40,
- 14,233, 73, 72,136,  5,134,  6,  5, 62,  6,  5,225, 95, 81, 71,233, 89,102,220,
- 83, 83, 67,222, 66, 66, 51, 72, 72, 80,231, 16, 32,142, 73, 73, 73, 73, 72,120,
-107, 54, 38, 38,166,132,  4,238, 20,110, 20, 94, 36,131, 33,169,125, 41,171,101,
-177, 53, 76, 77, 37, 21, 13,246,194, 32, 32, 80,128, 64,  2, 37, 38, 38, 37, 36,
- 25,  0, 37,  0, 37, 37,101,165,117,178,146,122,210, 70,202, 78,202,170,173,143,
-173,175,157,156,194,135,193,143,130,252,176,192, 85,168, 81,208, 35,  8,136,117,
-143,245,143,242,157,228,134,204,135,140,133,152,145, 72,171,148,204,203, 53, 53,
-181,181,181,181,181,201,201,223,214,214,214,214, 90, 90, 36, 36, 36, 90, 90, 85,
- 85, 85, 85, 85,  1, 85, 77, 77,173,173,173,  0, 13,178,178, 53,181,181,  0, 48,
- 86,214,201,214,214,128, 64,119,154, 58, 90, 58,154,119, 14,150,107, 47, 43, 22,
-206,  1,251,253,249,249,249,  1,  0,  0,230, 41, 41, 38,  0,  0,100,153,  0,228,
- 24,  0,  0,241, 15,242, 15,244,  0,  0,190,226,226,226,190,  0,136,115, 87,255,
- 39, 35,  0,142, 36,149,223,149, 36,142,144,186,144, 57, 40, 58,  0, 51, 50, 35,
- 42,236, 46,224,190,182,254, 84,212,136,136, 83, 34,174,116,174, 34, 83, 38, 47,
-239,126,111,175,166, 58,198,197,237,197,196, 56,181,170,186,159,186,170,229,119,
-246,246,226,227, 98,156, 85,119,223,174,255,253,115,  0,196,234,113,177,206,  0,
-124,125,127,127, 87, 85,120, 12,130,221,181,181,181,221,146, 14, 32, 64,101,116,
-116,108,109, 36, 36,  3, 68, 72,200,  6,  4, 24,233,  6,  8,  8,  8,152,105,107,
- 99,148,  8,  0,129,146, 97, 72, 80, 32, 31,  0, 16,208, 60, 82,145, 17, 17, 49,
-210, 16, 17, 18, 16, 16, 85,126, 18,129,  0, 68,249, 25, 25, 23, 17, 17, 23, 34,
- 34,255, 83, 83, 83, 83, 83, 95,132,132,255,170,170,170,170,170,170,142,  1, 70,
-168,166,168,167,162, 77,  0, 41,213,197,198,170,130,184,184,132, 72,232, 88, 84,
- 83,144, 16,239, 66, 66, 98, 99, 99,103,219, 66, 66,128,128,182,205,141,141,140,
-  8,  8,152,136,206,169,169,169,169,136,136, 16, 56,214, 86,210, 58,149, 20, 24,
-132,137,138,138,141,226,145,158,106, 16,  8,206,214, 32,160, 32, 34,220,114,137,
-139,140,116, 83,140,140,139,  8, 16,208, 40, 40,222, 57, 33,193, 49,201,199,103,
- 84, 84, 84, 36,  4, 71,136,128, 65, 33,114,146,148,100,220, 34,162,162, 42,234,
- 28,  8,  8, 17, 34, 33,108,171,170,170,115,  0,206, 49, 49,162,100, 40, 40, 38,
-  0,  1, 38,152,133,134,198,198,186,128, 78, 64, 78, 74, 78, 69, 69, 68,196,  0,
-112,246,166,164,164,253,165,188,112,140,135, 68, 36, 20, 15,136,112,198, 73,136,
-  4,226,161,169,166,160, 51, 66, 78,102, 39, 70,126,  6,  6,  6,  7,  7,  1,  1,
-  1,  7,  7,  6,252, 20,221, 38, 44,215, 37,199,  0,  1, 56,205,245,244,204, 57,
-208, 16,151, 90,220,154,152,103,157, 99, 98,100,248, 84, 72,148,241,146,114, 18,
- 57, 18, 18, 17,193, 33, 33, 33, 65,129,223, 80, 90,231,198,198, 61,  8, 17, 96,
-231, 24, 24, 24,231,146,146, 97,156, 99, 99, 99,252, 96, 98,156,115,140,132,100,
-131,128, 64, 39,202, 49, 53, 53,171, 34, 36, 40, 37,198,198, 69, 60,  5, 36, 24,
-231, 24, 24,214, 24,214, 24,214,192,129, 77, 82, 83, 78,131, 30,231,160,236, 21,
- 37, 93,139, 25, 92,148,245,  2, 36,235,177, 35, 18,162,255, 34,  8,255,136, 17,
-165,170,170,165,245,170,170, 69, 82, 82, 82, 82,215, 66, 82,133,172,170,170,170,
-250, 42,170, 82, 53, 53, 53, 53,191, 53, 53, 90,255,197,197,197,199,197,229,188,
-239,184,255,248,255, 24, 28,231,  0,  1,  1,  1,  1,  1,  1,  0,  0,132,132,132,
-132,  4,132,132,132,132,  4,  4,132,188,196,196,204, 52,  4,132,  2, 68, 68, 68,
-244, 68,244, 64, 64, 68, 24, 32, 46,162,163,162,179,130,130,224, 67,132,205,236,
-236,220,222, 72,  0,132,  8,144, 21,213, 53, 53, 51, 32, 32,208,  0,  8, 17, 16,
- 32, 60,  8,136,144,147, 64,132, 20, 25, 25, 57,218, 22, 20, 19, 16,160,165, 37,
-165,157,  4,  4, 30,  4,115,140,140,132, 68, 92, 47,252, 36, 36, 14,209, 49, 44,
-208, 16,220, 50, 34,196,  0, 40, 41, 41, 43, 41, 43,169, 41, 40,  0,242, 82,242,
- 34, 66,130,127, 82,114,  0, 79,219,119,108,250, 68, 79,218,110,248, 33,115,172,
- 36, 35, 36,172,115, 33,  0,200, 92, 74, 72,107, 45,105, 65,193, 40, 85,213, 41,
-145,155,170, 47,197, 69,  0,226,232, 71, 13, 74,237,247,248,226, 64, 92,220,136,
-128,136, 28, 63,191, 20,  4,  4,  7,  4,  4,  4,  5,  5,  7,  1,144,144, 28, 20,
-181, 66,132, 74, 82, 66, 99, 67,192,113, 86, 89, 16, 44, 81,142, 16,140,  7,160,
- 83, 84, 20, 19, 20,164,  3, 81,246,  0,  0,123, 99,227, 83, 11, 10, 50, 35,221,
- 32, 32, 68,133,238, 20, 32, 81,145, 17, 31, 44,176,188,180, 61, 66,132, 74, 82,
- 66, 99, 49, 66, 50, 66,181,  8,144,169, 74,  8,140,198,  8,198, 72,214, 33, 67,
-164, 41, 34, 49, 24, 33, 24, 72,187,  4,206, 18,229,  8,198, 99,132, 99, 41,247,
- 33, 66,165, 56, 41, 40,156,148,156,164, 89,130,100,138,242, 34,227,115, 82,115,
-208,119,  8,145, 42,200,  8,140,206, 74,206, 90,239, 66,181, 74,113, 18,113, 57,
- 41, 57, 41,123,132, 10,149,164,136,206, 96,128, 96,136,112, 32, 81,170, 44, 40,
- 16,162, 68, 68, 68, 68, 68, 68, 68, 68, 68,136, 16, 17, 57, 41, 69, 17,125, 57,
- 57, 17, 18,  7,  2,  7,  5,  5,  7,  7,  7,  2,  2,  2, 40, 68,195, 64,224, 16,
- 20,152,145, 33,113, 34, 34, 35,113, 70, 72, 82,208, 84,120, 33, 34, 35, 56, 71,
-132,  7, 36,231, 52, 36,169, 61,  9,145, 98, 68,143,242,  0,  0,  0,  0,  0,192,
-160,192,192,224,159,137, 22,134, 39, 39,148,211, 52, 68,243,  0,247, 26,214, 12,
-  4,110,164,232, 40, 41, 10,234,  9,136,146, 85,117,213,174,144,184, 87, 94, 63,
- 20,161, 55, 33,225, 55, 33, 82,107,141,196,136,136, 33, 74, 74, 75,232, 74,226,
-132,140,148,144,223, 27,144, 20, 24, 60, 17, 48,207,128, 64,  0,247,199,  8, 16,
- 33, 33,161,127, 66, 66,122, 66,123, 17, 63,177,113, 49, 63,  0,172,144, 40, 32,
- 60,  0,116, 20, 53, 85, 21,  0,  0,  0,  0,  0,  0,  8,148, 18, 10, 18,  8,255,
- 73, 74,230, 65, 98, 65,255,129,178,201,137,144,136,255, 28, 32,152,  4,172,  8,
-255,196, 39,164,197,167, 36,255,152,161,242,138,187,161,255, 16,150,156,150, 16,
- 16,255,207, 32, 32, 32,199,  4,255,129,130,186,168,169,169,255, 20,146,146, 18,
-156, 16,127, 11,204,169, 42,234,  9,252, 65, 65,113, 72, 73, 73,255, 16, 28, 26,
-150, 20, 16,255, 68, 36,165,103,  5,  5,255, 66,114, 74, 75, 90, 66,255, 16, 16,
- 28, 18,154, 22,255,202, 74,137, 79,202, 10,255, 64,114, 73,120, 81, 81,255,158,
- 16, 20,150,148, 20,255,247, 20,247, 22,150,148,255, 35, 50, 63, 62, 62, 50, 35,
-  8, 44, 47, 47, 47, 44,  8,162,229, 65,129,233,  9,229, 41,204,204, 56,  9,220,
-  9,166,190, 84,117,225, 91, 65, 53,247,103,173, 20,  6,196, 82,156,173,191,117,
- 41, 33,142, 82, 87,106,194, 39,162,144,184,209, 86, 93, 52, 16,117,130,177, 81,
- 23,193, 49,134,136, 18, 82,150, 10,194,209, 90, 91, 82,115, 25, 19, 70,104, 72,
- 73,206,100, 79,112, 49,150,110,  9, 60,  8, 66,130,147,162,196,248,136,  2,196,
-  8,  8, 62,201,  8, 65, 37, 83, 74,132,135,249, 12,227, 40, 70, 64,140,131,  6,
- 75, 81, 33,176, 72, 68, 76, 66, 34,162, 63,226, 23, 76, 80, 96, 96,127, 65, 28,
- 27, 45, 73,  9,  9,  9,  9,  3,  4,  8, 16, 16,  2,  1,  0, 24, 12, 16,136,132,
- 28, 16,255,  0, 12, 68, 69,104,202,101, 68,255,130, 65,130, 81,138,137,169, 80,
-255,  0,132, 32,170, 32, 44, 58, 32,255,  0,231,  3,196,166, 97, 71,  4,255, 88,
- 85, 89,121, 49, 17,125, 17,  3,194, 69,206, 68,207,132,207,132,  0,  3,196, 17,
-241, 37,164, 65, 64,  0,160, 64,161, 48, 60, 61, 60, 48, 32, 30, 32, 60, 42, 42,
- 42, 42, 34,212,  0,  0, 32,  0,  6,  3,132, 66, 65, 71,132, 47, 82, 44,  0,  0,
-  0, 35, 32, 32,224, 32, 32,235, 20,  8,  0,  0,  0,  4,132,138, 10, 19, 16, 16,
- 32, 32,  0,  0,  0, 35, 18,242,210,210,226,194, 50,  2,  2, 64,128,161, 50,191,
-190,190, 49,160,131, 64,  0,};
+ 64,  4,  8,  8,  8,  4, 96,160,175,160,111,191,196,191,198,191,240,  0,111,144,
+112,191,171,171,170,235,127, 76, 59,  8,  8, 61, 85,247, 53,221,230,234,235,170,
+187,158, 90,247, 82,146,107,126,212, 84, 73,175,223, 85,141,250,221,191, 43,179,
+221,165,154,198,178,201,108, 84, 88, 89,214,157, 99, 99, 81,136, 82,140,172,172,
+ 83,  0,  0,110,174,110,128,128,255,254,255,238, 27,188, 24,230, 20, 43, 43, 43,
+ 20,198, 72,144,140, 80, 50, 44,192, 65,121,212,213,214, 86,  7,  8,239, 26, 26,
+ 24, 37,  1, 29, 37, 73,209, 35, 29,  1,137,249, 77, 79, 73,120,  0, 16,255,169,
+169,169,169,  0, 18,127,198,198,198, 70, 66,132,151,150,122, 26,251, 80, 72,220,
+106, 90, 66,220, 64, 64,243, 72, 74, 74,113,  8,  8,216, 41, 41, 41,199,191,133,
+165,165,165,165, 29,224, 32, 38, 42, 44, 40, 39,254, 66,132,  8,144,144, 14,127,
+  8, 16, 49, 79, 72, 49,194, 63, 34,206, 18, 50,206, 33,158,170, 85, 85,213, 56,
+231, 24, 24,136, 24, 24,231,128, 81,101, 42, 43, 43, 28, 67, 60, 20,138,140,140,
+114,206, 49, 48, 19,148,148,127, 57,194, 74,182,214,214, 59,228, 19,193, 40, 26,
+ 26, 37,156, 35,163, 83, 99, 99,147,114,137,130,100,132,140,251,110,130, 14, 17,
+ 49, 49, 46, 56, 72, 81, 65,125, 85, 85,202, 42, 63,170,223, 74,202,  2, 17, 87,
+186, 84, 16,  1,  0, 34,  2, 15,  2, 34,  0,196,132,128,192,128,132,  0,  7,136,
+112, 83,112,136,  7,  4,228, 31,228, 59, 74,241,128,189,128,153,165,165,152,  0,
+ 71,  8,232,  8, 71,  0,154, 98, 98, 98, 98, 98,162, 55, 81, 33, 87, 81,137,143,
+106, 42, 42, 42, 42, 42, 42,185,198,198,186,198,198,199, 64, 64, 64, 79, 80, 80,
+240,112,146,166,170,179,165,135,238,174,174,126, 42, 42, 43,210, 82, 82,206, 66,
+ 66,111,165,214,214,221,212,212,164, 92, 82,242,167,162, 66, 76,123,123,251,174,
+170, 82,210,237,253, 95, 90,138,156,239, 46, 53, 49, 49,241, 21, 14, 88, 36, 52,
+ 36,167,166, 36,244, 52, 76,132,132,148, 99,222, 66, 66, 66,126, 66,130, 75,168,
+168,232,138,138,113, 33,161,177,179,237, 33, 33, 57, 70, 70,198,170,156,244,136,
+104, 27, 44,200,136,128,173, 82, 92,160,162,163, 92, 55, 76, 76, 74, 73, 73,206,
+206, 49, 48, 47, 80,146,108, 49, 30, 32, 64,198,197, 56,248,216,202, 42, 26, 26,
+231, 19, 18,178, 83, 83, 19, 12,118,138,131,122,146,146, 98, 65,225, 65,193, 79,
+ 65,129, 56,215,212,209,186,150,153,247, 20, 20, 16,247, 16, 16,140, 82, 82, 84,
+121,  4,  8,211,106, 74, 74, 74, 10, 14,220, 40,220, 40,189, 73,  6, 67, 82,250,
+ 82, 86,202, 99,106,153,154, 74, 43, 26,237,132, 64, 64,160,  0,128,  5, 75, 76,
+ 76, 74, 73, 50,  0, 34, 32,162, 34,102,170,231,171,169,215,253,212,252,212,204,
+ 42,122, 24,250, 42,201,  9, 12, 88,140, 24,  8, 63,139,140, 85,250, 85,253, 34,
+208, 72,103,200,127,200, 95,137, 30,136,188, 72,200,184, 89, 89, 84, 90, 89, 92,
+ 92,171,107,107,107,107, 65,171, 59, 77,157,173,157, 77, 59,135,203,181,151,149,
+139,231,  0,125,126,252,252,124,  0,  0,  0,243, 20, 20, 19,  0,  0,178,204,  0,
+242, 12,  0,  0,120,  7,121,  7,122,  0, 32,223, 81,241,145,159,  0, 58,145, 85,
+127, 84,144, 56, 66,232, 66,231,162,232,  2,206,202,142,168,176,184,128,248,216,
+248, 80, 83, 32, 35, 78,138,187,209,187,138, 78,153,188,190,249,190,188,153,232,
+ 24, 23,181, 21, 18,226,212,171,235,127,235,171,148,222,218,218,138,142,138,115,
+ 85,223,127,187,255,245,206,129,145,171,198,199,187,  1, 15, 15, 15, 15, 10, 10,
+ 15, 12,130,221,181,181,181,221,146, 14, 32, 64,101,116,116,108,109, 36, 36,  3,
+ 68, 72,200,  6,  4, 24,233,  6,  8,  8,  8,152,105,107, 99,148,  8,  0,129,146,
+ 97, 72, 80, 32, 31,  0, 16,208, 60, 82,145, 17, 17, 49,210, 16, 17, 18, 16, 16,
+ 85,126, 18,129,  0, 68,249, 25, 25, 23, 17, 17, 23, 34, 34,255, 83, 83, 83, 83,
+ 83, 95,116, 12, 55, 66, 50, 66, 58, 18,106,  4, 72,170, 45, 53, 85, 21,197,194,
+ 32, 65, 70,198,166,157,132,133,125, 20, 18, 23, 26, 26, 58,220, 16, 23,  2,  2,
+179,107,107,107,102, 66, 66,196, 68,117, 78, 76, 76, 76, 64, 64,132,196,182,181,
+149,213,173,164,196, 32, 73, 86, 82,110, 17,140,240, 80,132, 68,116,180,  4,  7,
+  4, 20,227,144, 72, 94,102,161,157, 97, 97, 94, 67,132,132, 68, 67,242,204, 12,
+ 12,136, 72, 62, 57,161,166,161, 33, 38, 57, 70,  6, 11, 10,146,146,161, 32,226,
+ 20, 20, 18, 81, 83,228, 68, 67,142, 17, 13,101, 89, 87, 80,152,  0,112,137,137,
+ 19, 37, 69, 69, 51,  0, 14, 49,193, 45, 51, 49, 49,209,  0,112,  1,244,212,116,
+ 46, 46, 37, 36,  0, 28,253, 41, 41, 41,255, 41, 47,156, 99, 33, 17,137, 69, 67,
+162, 28,241,146,162,129,248,168,170,169,168,140,208,211, 89, 73, 81,223,193,129,
+  1,  1,  1,  0,  0,  0,  1,  1,  1,252, 20,221, 38, 44,215, 37,199,  0,  1, 56,
+205,245,244,204, 57,208, 16,151, 90,220,154,152,103,157, 99, 98,100,248, 84, 72,
+148,241,146,114, 18, 57, 18, 18, 17,193, 33, 33, 33, 65,129,223, 80, 90,231,198,
+198, 61,  8, 17, 96,231, 24, 24, 24,231,146,146, 97,156, 99, 99, 99,252, 96, 98,
+156,115,140,132,100,131,128, 64, 39,202, 49, 53, 53,171, 34, 36, 40, 37,198,198,
+ 69, 60,  5, 36, 24,231, 24, 24,214, 24,214, 24,214,192,129, 77, 82, 83, 78,131,
+ 30,231,160,236, 21, 37, 93,139, 25, 92,148,245,  2, 36,235,177, 35, 18,162,255,
+ 34,  8,255,136, 17,165,170,170,165,245,170,170, 69, 82, 82, 82, 82,215, 66, 82,
+133,172,170,170,170,250, 42,170, 82, 53, 53, 53, 53,191, 53, 53, 90,255,197,197,
+197,199,197,229,188,239,184,255,248,255, 24, 28,231,  0,  1,  1,  1,  1,  1,  1,
+  0,  0,132,132,132,132,  4,132,132,132,132,  4,  4,132,188,196,196,204, 52,  4,
+132,  2, 68, 68, 68,244, 68,244, 64, 64, 68, 24, 32, 46,162,163,162,179,130,130,
+224, 67,132,205,236,236,220,222, 72,  0,132,  8,144, 21,213, 53, 53, 51, 32, 32,
+208,  0,  8, 17, 16, 32, 60,  8,136,144,147, 64,132, 20, 25, 25, 57,218, 22, 20,
+ 19, 16,160,165, 37,165,157,  4,  4, 30,  4,115,140,140,132, 68, 92, 47,252, 36,
+ 36, 14,209, 49, 44,208, 16,220, 50, 34,196,  0, 40, 41, 41, 43, 41, 43,169, 41,
+ 40,  0,242, 82,242, 34, 66,130,127, 82,114,  0, 79,219,119,108,250, 68, 79,218,
+110,248, 33,115,172, 36, 35, 36,172,115, 33,  0,200, 92, 74, 72,107, 45,105, 65,
+193, 40, 85,213, 41,145,155,170, 47,197, 69, 16, 18,248, 39, 45, 42, 77, 71,232,
+ 66,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,144,144, 28, 20,181, 66,132, 74, 82,
+ 66, 99, 67,192,113, 86, 89, 16, 44, 81,142, 16,140,  7,160, 83, 84, 20, 19, 20,
+164,  3, 81,246,  0,  0,123, 99,227, 83, 11, 10, 50, 35,221, 32, 32, 68,133,238,
+ 20, 32, 81,145, 17, 31, 44,176,188,180, 61, 66,132, 74, 82, 66, 99, 49, 66, 50,
+ 66,181,  8,144,169, 74,  8,140,198,  8,198, 72,214, 33, 67,164, 41, 34, 49, 24,
+ 33, 24, 72,187,  4,206, 18,229,  8,198, 99,132, 99, 41,247, 33, 66,165, 56, 41,
+ 40,156,148,156,164, 89,130,100,138,242, 34,227,115, 82,115,208,119,  8,145, 42,
+200,  8,140,206, 74,206, 90,239, 66,181, 74,113, 18,113, 57, 41, 57, 41,123,132,
+ 10,149,164,136,206, 96,128, 96,136,112, 32, 81,170, 44, 40, 16,162, 68, 68, 68,
+ 68, 68, 68, 68, 68, 68,136, 16, 17, 57, 41, 69, 17,125, 57, 57, 17, 18,  7,  2,
+  7,  5,  5,  7,  7,  7,  2,  2,  2, 40, 68,195, 64,224, 16, 20,152,145, 33,113,
+ 34, 34, 35,113, 70, 72, 82,208, 84,120, 33, 34, 35, 56, 71,132,  7, 36,231, 52,
+ 36,169, 61,  9,145, 98, 68,143,242,  0,  0,  0,  0,  0, 78,181, 54, 62, 63,164,
+156,160, 36,153,  1,188,214,177, 98, 39,112, 39, 64, 70, 72, 80, 83, 77, 71,145,
+169,168,175,112,132,196,186,243,254,165, 12,189, 10, 10,185,  8,149, 89,105, 39,
+ 65, 65, 10, 83, 84, 94, 68, 84, 17, 34, 98,162,135,250,223,132,164,196,228,142,
+128,124,  0,  0,  1,184, 57, 70,132, 10,  8, 15,254, 16, 16,209, 17,221,139,250,
+138,139,138,251,  0, 97,133, 67,  1,225,  0,165,164,169,169,169,  0,  3,  0,  1,
+  2,  0,  8,148, 18, 10, 18,  8,255, 73, 74,230, 65, 98, 65,255,129,178,201,137,
+144,136,255, 28, 32,152,  4,172,  8,255,196, 39,164,197,167, 36,255,152,161,242,
+138,187,161,255, 16,150,156,150, 16, 16,255,207, 32, 32, 32,199,  4,255,129,130,
+186,168,169,169,255, 20,146,146, 18,156, 16,127, 11,204,169, 42,234,  9,252, 65,
+ 65,113, 72, 73, 73,255, 16,156,154,150, 20, 16,255,  9,200, 42, 45,104,  8,255,
+ 65, 65,113, 73,105, 89,255, 40, 40, 36, 60, 42, 40,255,  3,201, 38,225, 71, 68,
+255,121, 65, 81, 89, 81, 81,255,222, 80,220, 90, 90, 80,255,143,200,255,248,250,
+202,143, 32,176,188,188,188,176, 32,162,229, 65,129,233,  9,229, 41,204,204, 56,
+  9,220,  9,166,190, 52,101,161, 59, 33,145,167,235,189,168,200,142, 35, 20, 85,
+154,112,  9, 40,100,174,116, 85,215, 77, 68,157, 32,172,148,133,176,140, 97,162,
+196,148,229, 66,240,180, 22, 22, 84,156,  6,196, 17, 90,146,146,115, 25, 19,156,
+140,229,155,  2, 15,  2,144, 32, 36, 40,177,126, 34, 64,113,194,130, 15,242, 66,
+ 16,201, 20,146, 33, 33,254,131,248, 74, 81, 16, 35, 32,  1,146,148,136,236,146,
+209, 19, 16,  8, 40,207,120,  5,211, 84, 88, 88, 95, 80, 71,198, 11, 18,  2,  2,
+130, 66,  0,  1,  2,  4,  4,  0,  0,  0, 24, 12, 16,136,132, 28, 16,255,  0, 12,
+ 68, 69,104,202,101, 68,255,130, 65,130, 81,138,137,169, 80,255,  0,132, 32,170,
+ 32, 44, 58, 32,255,  0,231,  3,196,166, 97, 71,  4,255, 88, 85, 89,121, 49, 17,
+125, 17,  3,194, 69,206, 68,207,132,207,132,  0,  3,196, 17,241, 37,164, 65, 64,
+  0,160, 64,161, 48, 60, 61, 60, 48, 32, 30, 32, 60, 42, 42, 42, 42, 34,212,  0,
+  0, 32,  0,  6,  3,132, 66, 65, 71,132, 47, 82, 44,  0,  0,  0, 35, 32, 32,224,
+ 32, 32,235, 20,  8,  0,  0,  0,132, 68,202, 74, 83,144, 16,224, 32,  0,  0,  0,
+132,200,255,251,251,199,131, 12,  0,  0,  1,  2,  2,  0,  2,  2,  2,  0,  2,  2,
+  1,  0,};
 
 // Index into bitmap_data for each group of glyph bitmaps
-static const unsigned int group_bitmap_offsets[] PROGMEM = {  0,  9,  9, 12, 15,
-135,205,744,762,874,964,975,978,1044,1135,1268,1280,1355,1420,1429,1519,1722,
-2296,2593,2785,2985,3183,3228,3342,3496,3643,3724,};
+static const unsigned int group_bitmap_offsets[] PROGMEM = {  0,  9,  9, 15, 18,
+138,208,782,800,912,1012,1023,1026,1092,1183,1316,1340,1415,1475,1570,1759,2270,
+2558,2750,2940,3138,3183,3291,3438,3578,3659,};
 
 // Starting glyph index for each group of glyph bitmaps
-static const unsigned int group_startidx[] PROGMEM = {  0,  1,  2,  3,  4, 42,
- 57,179,181,202,216,217,218,235,252,281,282,306,326,330,358,403,534,586,623,654,
-682,695,724,753,786,798,};
+static const unsigned int group_startidx[] PROGMEM = {  0,  1,  2,  4,  5, 43,
+ 58,188,190,211,226,227,228,245,262,292,294,317,336,366,409,525,575,612,641,669,
+682,710,738,769,781,};
 
 // Number of glyphs in each group of glyph bitmaps
-static const byte group_nglyphs[] PROGMEM = {  1,  1,  1,  1, 38, 15,122,  2,
- 21, 14,  1,  1, 17, 17, 29,  1, 24, 20,  4, 28, 45,131, 52, 37, 31, 28, 13, 29,
- 29, 33, 12,  8,};
+static const byte group_nglyphs[] PROGMEM = {  1,  1,  2,  1, 38, 15,130,  2,
+ 21, 15,  1,  1, 17, 17, 30,  2, 23, 19, 30, 43,116, 50, 37, 29, 28, 13, 28, 28,
+ 31, 12,  7,};
 
 // Starting row of glyph bitmap for each group
 static const byte group_rowstart[] PROGMEM = {  1,  0,  5,  4,  2,  0,  2,  0,
-  2,  0,  0,  2,  0,  2,  0,  0,  5,  0,  4,  2,  0,  2,  0,  2,  0,  0,  0,  0,
-  2,  0,  0,  0,};
+  2,  0,  0,  2,  0,  2,  0,  0,  5,  0,  2,  0,  2,  0,  2,  0,  0,  0,  0,  2,
+  0,  0,  0,};
 
 // Number of rows in bitmap for each group
 static const byte group_nrow[] PROGMEM = {  9,  0,  3,  3,  5,  7,  7,  9,  8,
- 10, 11,  3,  6,  7,  7, 12,  5,  5,  3,  5,  7,  7,  9,  8, 10, 11,  5,  6,  7,
-  7,  9, 12,};
+ 10, 11,  3,  6,  7,  7, 12,  5,  5,  5,  7,  7,  9,  8, 10, 11,  5,  6,  7,  7,
+  9, 12,};
 
 // Starting column of bitmap for each group
 static const byte group_colstart[] PROGMEM = {  1,  0,  1,  2,  1,  1,  1,  1,
-  1,  1,  1,  0,  0,  0,  0,  3,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,
-  0,  0,  0,  0,};
+  1,  1,  1,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,
+  0,  0,  0,};
 
 // Nuber of columns in bitmap for each group
 static const byte group_ncol[] PROGMEM = {  5,  0,  5,  3,  5,  5,  5,  5,  5,
-  5,  5,  4,  5,  6,  5,  3,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  6,
-  5,  6,  6,};
+  5,  5,  4,  5,  6,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  5,  6,  5,
+  6,  6,};
 
 /*
 Character bitmap data is sent to the screen from left to right, bottom to top:
@@ -1311,7 +1308,11 @@ but also too confusing.
 inline void load_rowpacked_glyph(const byte *c, 
   unsigned int index, 
   byte rowstart, byte nrows,
-  byte colstart, byte ncols ) {
+  byte colstart, byte ncols
+#ifdef COMPRESSED_GLYPH_GROUPS
+  , const byte *dictionary
+#endif
+  ) {
   
   // Start by zeroing out empty rows
   
@@ -1356,8 +1357,16 @@ inline void load_rowpacked_glyph(const byte *c,
     // Get second byte if needed
     if (is_split) row_data |= ((byte)pgm_read_byte(read_head+nrows)) << (8-bit_offset);
     
+    row_data &= bitmask;
+    
+#ifdef COMPRESSED_GLYPH_GROUPS
+    // Compressed groups store an index into a dictionary of rows, which have
+    // already been shifted into place.
+    if (dictionary) char_bitmap[r] = pgm_read_byte(dictionary + row_data);
+    else
+#endif
     // Shift into place and store in the character bitmap register
-    char_bitmap[r] = (row_data&bitmask) << colstart;
+    char_bitmap[r] = row_data << colstart;
     
     r++;
     read_head++;
@@ -1373,9 +1382,17 @@ byte load_glyph_bitmap(unsigned int i) {
   int found = binary_search_range(i,NGROUPS,group_startidx,group_nglyphs);
   if (found<0) return NOT_IMPLEMENTED;
   unsigned int offset = pgm_read_word(group_bitmap_offsets + found);
+#ifdef COMPRESSED_GLYPH_GROUPS
+  unsigned int doffset = pgm_read_word(group_dictionary_offsets + found);
+  const byte *dictionary = doffset==NO_DICTIONARY? NULL : row_dictionary+doffset;
+#endif
   load_rowpacked_glyph(bitmap_data+offset, i - pgm_read_word(group_startidx +found),
     pgm_read_byte(group_rowstart +found), pgm_read_byte(group_nrow +found),
-    pgm_read_byte(group_colstart +found), pgm_read_byte(group_ncol +found));
+    pgm_read_byte(group_colstart +found), pgm_read_byte(group_ncol +found)
+#ifdef COMPRESSED_GLYPH_GROUPS
+    , dictionary
+#endif
+    );
   return LOADED;
 }
 
@@ -1520,9 +1537,9 @@ static const byte block_lengths_x16[] PROGMEM = {  8,  8,  8, 13,  6,  5,  7,
 // Packed data describing each block;
 // Low 2 bits indicates block type, as above
 // Remaining bits tells us where to find more information
-static const byte blockcodes[] PROGMEM = { 90, 94, 98,102,  3,  7, 13,106,110,
- 11,114,118,122, 15, 19, 23,126, 27,130,134, 31, 35, 39, 17,  5,  1, 33, 47,138,
-  9, 51, 55, 59,142,146,150,154, 63, 67, 71,158, 21,  0, 25,  0, 75, 79, 83, 87,
+static const byte blockcodes[] PROGMEM = { 86, 90, 94, 98,  3,  7, 13,102,106,
+ 11,110,114,118, 15, 19, 23,122, 27,126,130, 31, 35, 39, 17,  5,  1, 33, 47,134,
+  9, 51, 55,138,142,146,150,154, 59, 63, 67,158, 21,  0, 25,  0, 71, 75, 79, 83,
  29,};
 
 // For DENSE and SPARSE blocks, the index code provides the offset into the
@@ -1609,17 +1626,34 @@ int handle_unicode_mapping_table(byte blocktype, byte i, byte c) {
 /** Dispatch unicode point to subroutines for handling various blocks and 
  *  range of codepoints.
  */
-int load_unicode(uint32_t code) {
+int find_unicode(uint32_t code) {
 
   //Serial.print("Code ");
   //Serial.println(code);
 
+#ifdef PROFILE_ASCII_TABLE
+  // Printable ASCII is stored as raw bitmaps; skip all lookups
+  if (code>=0x20 && code<0x7F) {
+    memcpy_P(char_bitmap, ascii_bitmaps+(code-0x20)*CH, CH);
+    return LOADED;
+  }
+#endif
+
   // Divide code by 16 to get its "row" in the uncode table
   unsigned int coderow = code>>4;
   // Skip codepoints past the end of the mapped blocks
   if (coderow>=LASTROW+1) return NOT_IMPLEMENTED;
+#ifdef PROFILE_PAGE_TABLE
+  // Start at the first block ending after the start of this 256-codepoint 
+  // page, and scan forward; pages seldom hold more than a few blocks.
+  int found = pgm_read_byte(block_pages + (coderow>>4));
+  while (found<NBLOCKS && coderow>=pgm_read_word(&block_starts_x16[found])
+                                  +pgm_read_byte(&block_lengths_x16[found])) found++;
+  if (found>=NBLOCKS || coderow<pgm_read_word(&block_starts_x16[found])) found=-1;
+#else
   // Binary search to find function to handle this block
   int found = binary_search_range(coderow, NBLOCKS, block_starts_x16, block_lengths_x16);
+#endif
   
   //Serial.print("Block info index ");
   //Serial.println(found);
@@ -1652,33 +1686,25 @@ int load_unicode(uint32_t code) {
   return handle_unicode_mapping_table(blocktype, blockidx, code);
 }
 
+/** Load a unicode codepoint from the font tables or, failing that, from the
+ *  glyphs uploaded by the host (softglyphs.h).
+ */
+int load_unicode(uint32_t code) {
+  int result = find_unicode(code);
+#ifdef SOFT_GLYPHS
+  if (result==NOT_IMPLEMENTED) result = load_soft_glyph(code);
+#endif
+  return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-/** Parse utf-8 encoded unicode codepoint. Based on the first byte, this will
- *  attempt to read up to 3 more bytes from the serial input. If a valid 
- *  unicode sequence is found, it will attempt to interpret and draw the 
- *  corresponding character. Returns FAIL if an invalid utf-8 sequence 
- *  encountered, or if there was an error in rendering the unicode point. If it
- *  cannot render the given unicode point, the replacement character <?> should
- *  be rendered instead. 
- *  @param byte1: first byte of a putative unicode sequence (we'll wait for 
- *      more if needed)
+/** Finish drawing a glyph at the cursor, after load_unicode or 
+ *  handle_transform, and advance the cursor. Loaded glyphs are styled and
+ *  drawn from char_bitmap; on an error, the replacement character <?> is 
+ *  drawn instead. 
+ *  @param return_code: what loading the glyph returned
  */
-int parse_utf8(byte byte1) {
-  uint32_t code = byte1;
-  if (byte1>=128) {
-    int nbytes = 0;
-    if      ((byte1>>5)==0b110  ) {code=byte1 & 0b11111; nbytes=1;}
-    else if ((byte1>>4)==0b1110 ) {code=byte1 &  0b1111; nbytes=2;}
-    else if ((byte1>>3)==0b11110) {code=byte1 &   0b111; nbytes=3;}
-    if (!nbytes) return FAIL; // Ignore bad utf-8
-    for (int j=0; j<nbytes; j++) {
-      byte b = blocking_read();
-      if (!((b>>6)==0b10)) return FAIL; // Ignore bad utf-8
-      code = (code<<6)|(b&0b111111);}
-  }
-  //pause_incoming_serial();
-  prepare_cursor();
-  byte return_code = load_unicode(code);
+int draw_loaded(byte return_code) {
   if (return_code == LOADED) {
     // Soft-fonts draw, but mapped fonts only load the character bitmap.
     // This allows the mathematical alphanumerics soft-font to re-use the
@@ -1686,7 +1712,7 @@ int parse_utf8(byte byte1) {
     // further style characters before drawing. 
     drawStyledChar();
     advance_cursor(1);   
-    return SUCCESS;
+    return LOADED;
   }
   else if (return_code != SUCCESS) {
     //load_and_draw_glyph(REPLACEMENT_CHARACTER);
@@ -1697,5 +1723,18 @@ int parse_utf8(byte byte1) {
   return return_code;
 }
 
+/** Draw a unicode codepoint at the cursor, and advance the cursor. The utf-8
+ *  decoding is done by the input parser (parser.h). Returns FAIL if there was 
+ *  an error in rendering the unicode point. If it cannot render the given 
+ *  unicode point, the replacement character <?> should be rendered instead. 
+ *  Returns LOADED if the styled glyph is left in char_bitmap, so that it 
+ *  can be drawn again without reloading (see REP in control.h). 
+ *  @param code: unicode codepoint
+ */
+int draw_unicode(uint32_t code) {
+  prepare_cursor();
+  return draw_loaded(load_unicode(code));
+}
+
 
 #endif // FONTMAP
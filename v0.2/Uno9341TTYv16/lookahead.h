@@ -0,0 +1,131 @@
+#ifndef LOOKAHEAD_H
+#define LOOKAHEAD_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Dropping characters that are about to be overwritten
+//
+// Progress bars and spinners redraw a line over and over, going back to its
+// start with CR. When we've fallen behind, the next versions of the line may
+// already be waiting in the receive buffer, and drawing all but the last one
+// is wasted time. So before drawing a character we look ahead in the buffer.
+// If the line goes on to a CR, and what follows the CR writes over this
+// cell, we skip drawing it and only advance the cursor.
+//
+// The look-ahead understands printable characters below U+0300 (these take
+// one cell, and don't combine), CR, SGR (CSI m), erase in line (CSI K), and
+// cursor to column (CSI G). Anything else could move to another row, or
+// depend on what is on screen, so it ends the look-ahead. So does a 
+// compressed copy (see uart.h), as what it holds isn't known until it's read.
+//
+// Before the first CR we only check that nothing like that happens and that
+// the line doesn't wrap. After it, we mark the cells that get written or
+// erased in lookahead_cover. Everything up to the CR has already been
+// received, so the result holds until the CR is handled, and the buffer is
+// scanned once per line rather than once per character.
+//
+// Only input that is already buffered can replace what we skip. So the
+// screen is at most one receive buffer behind the input, and the last
+// version of the line is always drawn. The number of glyphs skipped (modulo
+// 65536) is reported by CSI ? 902 n, as CSI ? 902 ; count n.
+
+#define LOOKAHEAD_REPORT (902)
+
+// Tokens left to handle before lookahead_cover is out of date
+byte     lookahead_left = 0;
+// Bit c is set if column c of the cursor row will be overwritten
+byte     lookahead_cover[BLINK_BYTES_PER_ROW];
+uint16_t glyphs_skipped = 0;
+
+/** Mark columns c0..c1-1 as overwritten */
+void lookahead_mark(byte c0, byte c1) {
+  for (byte c=c0; c<c1; c++) lookahead_cover[c>>3] |= 1<<(c&0b111);
+}
+
+/** Scan the receive buffer to fill lookahead_cover and lookahead_left, for
+ *  a character about to be drawn at the cursor
+ */
+void lookahead_scan() {
+  memset(lookahead_cover,0,BLINK_BYTES_PER_ROW);
+  byte n       = uart_available();
+  byte i       = uart_rx_tail;
+  byte c       = col+1; // Where the cursor goes after this character
+  byte seen_cr = 0;
+  byte k;
+  lookahead_left = 0;
+  #ifdef LZ_INPUT
+  // The ring buffer doesn't follow on until the copy in progress is done
+  if (uart_lz_copy) return;
+  #endif
+  for (k=0; k<n; k++, i=(i+1)&UART_RX_MASK) {
+    uint16_t t = uart_rx_buffer[i];
+    if ((0x20<=t && t<0x7F) || (0xA0<=t && t<0x300)) {
+      // Would the line wrap here?
+      if (c>=TC) break;
+      if (seen_cr) lookahead_mark(c,c+1);
+      c++;
+    }
+    else if (t==CARRIAGE_RETURN) {
+      if (!seen_cr) lookahead_left = k+1;
+      seen_cr = 1;
+      c = 0;
+    }
+    else if (t==ESCAPE || t==CSI) {
+      // CSI, with an optional parameter
+      if (t==ESCAPE) {
+        if (++k>=n) break;
+        i = (i+1)&UART_RX_MASK;
+        if (uart_rx_buffer[i]!='[') break;
+      }
+      uint16_t p = 0;
+      for (k++; k<n; k++) {
+        i = (i+1)&UART_RX_MASK;
+        t = uart_rx_buffer[i];
+        if ('0'<=t && t<='9') p = min(p*10+(t-'0'),999);
+        else if (t!=';') break;
+      }
+      if (k>=n) break;
+      if (t=='m') continue;
+      else if (t=='G') c = min(max(p,1),TC)-1;
+      else if (t=='K') {
+        // Erasing ahead of the CR could clear cells we have yet to draw
+        if (!seen_cr) continue;
+        switch (p) {
+          case 0: lookahead_mark(c,TC);   break;
+          case 1: lookahead_mark(0,c+1);  break;
+          case 2: lookahead_mark(0,TC);   break;
+        }
+      }
+      else break;
+    }
+    else break;
+  }
+  // Without a CR, come back once everything we've looked at is handled
+  if (!seen_cr) lookahead_left = k;
+}
+
+/** Called with each token handled */
+inline void lookahead_step() {
+  if (lookahead_left) lookahead_left--;
+}
+
+/** Called before drawing a character that takes one cell. Returns 1 if
+ *  input already received will overwrite the cell at the cursor. The cursor
+ *  has then been advanced, and there's nothing to draw.
+ */
+byte lookahead_skip() {
+  prepare_cursor();
+  if (!lookahead_left) lookahead_scan();
+  if (!((lookahead_cover[col>>3]>>(col&0b111))&1)) return 0;
+  col++;
+  glyphs_skipped++;
+  return 1;
+}
+
+/** Reply to CSI ? 902 n with the number of glyphs skipped */
+void lookahead_report() {
+  uart_print("\x1b[?");
+  uart_write_uint(LOOKAHEAD_REPORT); uart_write(';');
+  uart_write_uint(glyphs_skipped);   uart_write('n');
+}
+
+#endif // LOOKAHEAD_H
@@ -0,0 +1,400 @@
+#ifndef PARSER_H
+#define PARSER_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Byte-at-a-time input parser
+//
+// A simplified ECMA-48 state machine. The receive interrupt has already
+// decoded utf-8 (see uart.h), and each token is handled by parse_token(),
+// which never waits for more input: a partly-received escape sequence is 
+// kept in the parser state until the rest arrives, so idle() (blinking, bell
+// timeout) keeps running in the meantime.
+//
+// OSC strings (ESC ]) are split into ;-separated fields for parse_OSC_field 
+// in control.h. With SOFT_GLYPHS defined, DCS strings (ESC P) that upload
+// glyphs go to softglyphs.h. Strings we don't support (other DCS, SOS ESC X,
+// PM ESC ^, and APC ESC _) are skipped up to their terminator, ST (ESC \) or
+// BEL, rather than drawn. Likewise nF escapes (ESC + intermediate bytes + final byte), and
+// CSI sequences too long for cs_param_buff. CAN and SUB abandon any sequence.
+//
+// G0 and G1 can be designated US ASCII (ESC ( B, ESC ) B) or DEC Special
+// Graphics (ESC ( 0, ESC ) 0), and selected with SI and SO. Line drawing then
+// costs one byte per character, and goes straight to _boxdrawing.
+//
+// In glyph word mode (CSI ? 903 h, with GLYPH_WORDS defined) the host has
+// looked characters up in the font tables itself. Each graphic character
+// from U+00A0 to U+FFFF then stands for the packed glyph word (base glyph 
+// and transform, as in codepoint_map in fontmap.h) 0xA0 below it, and goes
+// straight to handle_transform. Characters past U+FFFF carry an ordinary 
+// character 0x10000 below them, for glyphs that aren't in the tables (soft
+// fonts, combining marks). ASCII, controls, and escape sequences work as 
+// usual, so SGR and REP (CSI b) serve for attributes and runs. CSI ? 903 l
+// goes back to characters.
+
+#define PARSE_GROUND     (0) // Printing characters, executing C0 controls
+#define PARSE_ESCAPE     (1) // After ESC
+#define PARSE_ESC_INTER  (2) // ESC + intermediate bytes, ignored until final
+#define PARSE_CSI_PARAM  (3) // CSI parameter bytes 0x30-0x3F
+#define PARSE_CSI_INTER  (4) // CSI intermediate bytes 0x20-0x2F
+#define PARSE_CSI_IGNORE (5) // Malformed or too-long CSI, skip to final byte
+#define PARSE_STRING     (6) // OSC/DCS/SOS/PM/APC payload, skip to ST or BEL
+#define PARSE_STRING_ESC (7) // ESC inside a string, ST if followed by '\'
+#define PARSE_OSC        (8) // OSC fields, handled as each ';' arrives
+#define PARSE_DCS        (9) // DCS parameter bytes, up to the final byte
+#define PARSE_DLD       (10) // Glyph data of a DCS ... { (softglyphs.h)
+
+// C1 string controls, as sent in 8-bit form
+#define C1_IND (0x84)
+#define C1_NEL (0x85)
+#define C1_RI  (0x8D)
+#define C1_DCS (0x90)
+#define C1_SOS (0x98)
+#define C1_ST  (0x9C)
+#define C1_OSC (0x9D)
+#define C1_PM  (0x9E)
+#define C1_APC (0x9F)
+
+byte     parse_state    = PARSE_GROUND;
+uint16_t high_surrogate = 0; // First token of a codepoint past U+FFFF
+byte     esc_intermediate = 0; // Intermediate byte of an nF escape (0xFF: several)
+
+// Character sets: designations of G0/G1 ('B' or '0'), and which is in use
+byte     charset_g[2]   = {'B','B'};
+byte     charset_shift  = 0;
+byte     dec_graphics   = 0; // The selected set is DEC Special Graphics
+
+// DEC Special Graphics, characters 0x5F-0x7E
+const uint16_t dec_graphics_map[32] PROGMEM = {
+  0x00A0, // _ blank
+  0x25C6, // ` diamond
+  0x2592, // a checkerboard
+  0x2409, 0x240C, 0x240D, 0x240A, // b-e HT FF CR LF symbols
+  0x00B0, 0x00B1, // f-g degree, plus/minus
+  0x2424, 0x240B, // h-i NL VT symbols
+  0x2518, 0x2510, 0x250C, 0x2514, 0x253C, // j-n corners and cross
+  0x23BA, 0x23BB, 0x2500, 0x23BC, 0x23BD, // o-s scan lines 1,3,5,7,9
+  0x251C, 0x2524, 0x2534, 0x252C, 0x2502, // t-x tees and vertical line
+  0x2264, 0x2265, 0x03C0, 0x2260, 0x00A3, 0x00B7 // y-~ 
+};
+
+/** Recompute dec_graphics after a designation or shift */
+void update_charset() {
+  dec_graphics = charset_g[charset_shift]=='0';
+}
+
+/** Back to US ASCII in G0 and G1, with G0 selected */
+void reset_charsets() {
+  charset_g[0] = charset_g[1] = 'B';
+  charset_shift = 0;
+  update_charset();
+}
+
+/** Draw a graphic character, and remember it for REP */
+void draw_graphic(uint32_t code) {
+  rep_code = code;
+  if ((code<0x300 && lookahead_skip()) || cells_write(code)) {
+    rep_loaded = 0;
+    return;
+  }
+  cell_code  = code;
+  rep_loaded = draw_unicode(code)==LOADED;
+}
+
+/** Draw a character from DEC Special Graphics (0x5F-0x7E) */
+void draw_dec_graphics(byte c) {
+  uint16_t code = pgm_read_word(&dec_graphics_map[c-0x5F]);
+  if (lookahead_skip()) {
+    rep_code   = code;
+    rep_loaded = 0;
+    return;
+  }
+  if ((code&0xFF80)==0x2500) {
+    // Box drawing, skipping the block lookup
+    rep_code   = code;
+    rep_loaded = 0;
+    cell_code  = code;
+    prepare_cursor();
+    _boxdrawing((uint16_t)(code-0x2500));
+  }
+  else draw_graphic(code);
+}
+
+/** Draw the replacement character <?> for bad input, so we know about it */
+void draw_bad_input() {
+  rep_code = rep_loaded = 0;
+  prepare_cursor();
+  load_glyph_bitmap(REPLACEMENT_CHARACTER);
+  drawCharFancy(CH*row,CW*col,BLUE,BLACK,NORMAL,NORMAL,HALFWIDTH);
+  advance_cursor(1);
+}
+
+#ifdef GLYPH_WORDS
+/** Draw a packed glyph word at the cursor, skipping the unicode lookup.
+ *  The styled glyph is left in char_bitmap for REP, as with draw_unicode.
+ */
+void draw_glyph_word(uint16_t w) {
+  // Don't read past the end of the font for a word that's out of range.
+  // handle_transform loads bitmap base-1, and base 0 draws nothing.
+  uint16_t base = (w&511) + ((w&65024)==T_EP2? 512 : 0);
+  if (base && base-1>=NGLYPHS) {draw_bad_input(); return;}
+  rep_code  = REP_GLYPH_WORD | w;
+  cell_code = 0; // The cell model only knows codepoints
+  prepare_cursor();
+  rep_loaded = draw_loaded(handle_transform(w))==LOADED;
+}
+#endif
+
+/** Execute a C0 control code, from the ground state or within a CSI */
+void execute_C0(byte c) {
+  switch (c) {
+    case BELL: bell(); break;
+    case BACKSPACE: backspace(); break;
+    case HORIZONTAL_TAB: {
+      byte colto = min(TC-1,(col+5)&0b11111100);
+      byte spaces = colto-col;
+      for (byte i=0; i<spaces; i++) print(" ");
+      } break;
+    case NEWLINE:
+      newline();
+      break;
+    case VERTICAL_TAB:
+      scroll(max(0,4-row));
+      row=max(0,row-4);
+      break;
+    case FORM_FEED:
+      scroll(max(0,1-row));
+      row=max(0,row-1);
+      break;
+    case CARRIAGE_RETURN:
+      col=0;
+      break;
+    case SHIFT_OUT: charset_shift=1; update_charset(); break;
+    case SHIFT_IN:  charset_shift=0; update_charset(); break;
+    case DEVICE_CONTROL4:
+      // Non-standard code; Using this for screen capture;
+      // Experimental!
+      {
+        bell();
+        flush_cells();
+        for (int y=0; y<320; y++) {
+          SET_XY_RANGE(0,239,y);
+          tft.readPixels(240, copy_buffer);
+          for (byte x=0; x<240; x++) {
+            uart_write(copy_buffer[240-1-x]);
+          }
+        }
+      }
+      break;
+  }
+}
+
+/** Start collecting a CSI sequence */
+void begin_CSI() {
+  n_cs_param_bytes = 0;
+  cs_intermediate  = 0;
+  parse_state = PARSE_CSI_PARAM;
+}
+
+/** Start collecting an OSC string */
+void begin_OSC_string() {
+  n_cs_param_bytes = 0;
+  begin_OSC();
+  parse_state = PARSE_OSC;
+}
+
+/** Finish an OSC field; n_cs_param_bytes is 0xFF if it was unusable */
+void end_OSC_field() {
+  byte ok = n_cs_param_bytes!=0xFF;
+  if (ok) cs_param_buff[n_cs_param_bytes] = 0;
+  parse_OSC_field(ok);
+  n_cs_param_bytes = 0;
+}
+
+/** Handle a byte within an OSC string */
+void parse_osc(byte c) {
+  if (c==BELL || c==C1_ST) {end_OSC_field(); parse_state = PARSE_GROUND;}
+  else if (c==';') end_OSC_field();
+  else if (n_cs_param_bytes<CSMAXBYTES && 0x20<=c && c<0x7F)
+    cs_param_buff[n_cs_param_bytes++] = c;
+  else n_cs_param_bytes = 0xFF;
+}
+
+/** Start a DCS string */
+void begin_DCS() {
+  #ifdef SOFT_GLYPHS
+  begin_soft_glyphs();
+  parse_state = PARSE_DCS;
+  #else
+  parse_state = PARSE_STRING;
+  #endif
+}
+
+#ifdef SOFT_GLYPHS
+/** Handle a byte of DCS parameters. Only glyph uploads (final byte '{') are
+ *  supported, anything else is skipped.
+ */
+void parse_dcs(byte c) {
+  if (('0'<=c && c<='9') || c==';') soft_glyph_parameter(c);
+  else if (c==BELL || c==C1_ST) parse_state = PARSE_GROUND;
+  else if (c=='{' && soft_glyph_data_begins()==SUCCESS) parse_state = PARSE_DLD;
+  else parse_state = PARSE_STRING;
+}
+#endif
+
+/** Handle the byte following ESC */
+void parse_escape(byte c) {
+  parse_state = PARSE_GROUND;
+  switch (c) {
+    case '[': begin_CSI();      break; // CSI sequence
+    case '7': save_cursor();    break; // Save cursor
+    case '8': restore_cursor(); break; // Restore cursor
+    case 'c': reset(); reset_charsets(); break; // Reset all state
+    case ']': begin_OSC_string(); break; // OSC
+    case 'D': index_down(); break; // Index
+    case 'E': newline();    break; // Next line
+    case 'M': index_up();   break; // Reverse index
+    case 'P': begin_DCS(); break; // DCS
+    case 'X': // SOS
+    case '^': // PM
+    case '_': // APC
+      parse_state = PARSE_STRING; break;
+    default:
+      if (0x20<=c && c<=0x2F) {
+        esc_intermediate = c;
+        parse_state = PARSE_ESC_INTER;
+      }
+  }
+}
+
+/** Handle a byte of an nF escape, ESC + intermediate bytes + final byte */
+void parse_esc_intermediate(byte c) {
+  if (0x20<=c && c<=0x2F) esc_intermediate = 0xFF;
+  else if (0x30<=c && c<=0x7E) {
+    parse_state = PARSE_GROUND;
+    // Designate G0 or G1; sets other than DEC graphics are taken as ASCII
+    if (esc_intermediate=='(' || esc_intermediate==')') {
+      charset_g[esc_intermediate==')'] = c=='0'? '0' : 'B';
+      update_charset();
+    }
+  }
+}
+
+/** Handle a byte within a CSI sequence */
+void parse_csi(byte c) {
+  if (0x40<=c && c<=0x7E) {
+    // Final byte
+    byte ignore = parse_state==PARSE_CSI_IGNORE;
+    parse_state = PARSE_GROUND;
+    if (!ignore) {
+      cs_param_buff[n_cs_param_bytes] = 0; // Null terminate, important!
+      cs_final_byte = c;
+      if (c=='m') parse_SGR();
+      else parse_CSI_sequence();
+    }
+  }
+  else if (0x30<=c && c<=0x3F) {
+    // Parameter bytes can't follow intermediate bytes
+    if (parse_state!=PARSE_CSI_PARAM) parse_state = PARSE_CSI_IGNORE;
+    else if (n_cs_param_bytes>=CSMAXBYTES) parse_state = PARSE_CSI_IGNORE;
+    else cs_param_buff[n_cs_param_bytes++] = c;
+  }
+  else if (0x20<=c && c<=0x2F) {
+    if (parse_state==PARSE_CSI_PARAM) parse_state = PARSE_CSI_INTER;
+    cs_intermediate = cs_intermediate? 0xFF : c;
+  }
+  else if (c<0x20) execute_C0(c);
+  else parse_state = PARSE_CSI_IGNORE;
+}
+
+/** Handle a token in the ground state: print, execute, or begin a sequence */
+void parse_ground(uint16_t t) {
+  if (t<0x20) execute_C0(t);
+  else if (t<0x7F) {
+    // Fast-track ASCII TODO
+    if (dec_graphics && t>=0x5F) draw_dec_graphics(t);
+    else draw_graphic(t);
+  }
+  else if (t<0xA0) switch (t) {
+    // High control code?
+    case DELETE: backspace();        break;
+    case CSI:    begin_CSI();        break;
+    case C1_OSC: begin_OSC_string(); break;
+    case C1_IND: parse_escape('D');  break;
+    case C1_NEL: parse_escape('E');  break;
+    case C1_RI:  parse_escape('M');  break;
+    case C1_DCS: begin_DCS(); break;
+    case C1_SOS:
+    case C1_PM:
+    case C1_APC: parse_state = PARSE_STRING; break;
+  }
+  #ifdef GLYPH_WORDS
+  else if (glyph_words) draw_glyph_word(t-0xA0);
+  #endif
+  else draw_graphic(t);
+}
+
+/** Process the next token of input */
+void parse_token(uint16_t t) {
+  lookahead_step();
+  // The first half of a surrogate pair doesn't change whether the previous
+  // character can accept combining marks
+  if ((t&TOKEN_SURROGATE_MASK)==TOKEN_HIGH_SURROGATE) {high_surrogate=t; return;}
+  // If the input results in a caharacter that can
+  // accept combining marks, this flag will be set.
+  new_combining_ok = 0;
+  if ((t&TOKEN_SURROGATE_MASK)==TOKEN_LOW_SURROGATE) {
+    // A codepoint past U+FFFF, or on its own, a byte that wasn't valid utf-8
+    if (parse_state==PARSE_GROUND) {
+      if (high_surrogate) {
+        uint32_t code = 0x10000
+          + ((uint32_t)(high_surrogate&0x3FF)<<10) + (t&0x3FF);
+        #ifdef GLYPH_WORDS
+        if (glyph_words) code -= 0x10000;
+        #endif
+        draw_graphic(code);
+      }
+      else draw_bad_input();
+    }
+    high_surrogate = 0;
+  }
+  else if (t==CANCEL || t==SUBSTITUTE) parse_state = PARSE_GROUND;
+  else if (t==ESCAPE) {
+    // ESC within a string may begin ST
+    if (parse_state==PARSE_OSC) {end_OSC_field(); parse_state = PARSE_STRING_ESC;}
+    else parse_state = parse_state==PARSE_STRING || parse_state==PARSE_DLD? 
+      PARSE_STRING_ESC : PARSE_ESCAPE;
+  }
+  else if (parse_state==PARSE_GROUND) parse_ground(t);
+  else {
+    // Sequences are ASCII; anything else ends up ignored
+    byte c = t>0xFF? 0xFF : t;
+    switch (parse_state) {
+      case PARSE_ESCAPE: parse_escape(c); break;
+      case PARSE_ESC_INTER: parse_esc_intermediate(c); break;
+      case PARSE_CSI_PARAM:
+      case PARSE_CSI_INTER:
+      case PARSE_CSI_IGNORE: parse_csi(c); break;
+      case PARSE_STRING:
+        if (c==BELL || c==C1_ST) parse_state = PARSE_GROUND;
+        break;
+      case PARSE_OSC: parse_osc(c); break;
+      #ifdef SOFT_GLYPHS
+      case PARSE_DCS: parse_dcs(c); break;
+      case PARSE_DLD:
+        if (c==BELL || c==C1_ST) parse_state = PARSE_GROUND;
+        else soft_glyph_data(c);
+        break;
+      #endif
+      case PARSE_STRING_ESC:
+        // ST ends the string; anything else begins a new escape sequence
+        if (c=='\\') parse_state = PARSE_GROUND;
+        else parse_escape(c);
+        break;
+    }
+  }
+  // Update whether the most recently drawn character should accept
+  // combining modifiers
+  combining_ok = new_combining_ok;
+}
+
+#endif // PARSER_H
@@ -0,0 +1,278 @@
+#ifndef RECTANGLES_H
+#define RECTANGLES_H
+
+////////////////////////////////////////////////////////////////////////////////
+// VT400 rectangular area operations
+//
+// These work on the screen (GRAM) directly, since we don't keep a copy of
+// the text. All are CSI sequences with the intermediate byte '$':
+//
+//   DECFRA  CSI Pch;Pt;Pl;Pb;Pr $ x         Fill with character Pch
+//   DECERA  CSI Pt;Pl;Pb;Pr $ z             Erase
+//   DECCRA  CSI Pt;Pl;Pb;Pr;Pp;Pt';Pl';Pp' $ v  Copy to Pt',Pl' (pages ignored)
+//   DECCARA CSI Pt;Pl;Pb;Pr;Ps... $ r       Change attributes
+//   DECRARA CSI Pt;Pl;Pb;Pr;Ps... $ t       Reverse attributes
+//
+// Rectangles are given as lines (1 is the top) and columns (1 is the left),
+// inclusive; 0 or a missing parameter means the edge of the screen.
+//
+// DECCARA takes SGR parameters. Colors (30-49, 90-97, 38/48, 0 for the
+// defaults), blink (5, 6, 25) and reverse video (7, 27) are supported.
+// DECRARA toggles blink (5) and reverse video (7), or both (0). Glyph styles
+// (bold, underline...) would need the characters redrawn, and are ignored.
+// Each cell is read back, and its most common color taken as its background;
+// everything else is foreground. Reverse video swaps the two. We keep a flag
+// for each cell drawn in reverse video (see blinker.h), so that DECCARA 7
+// only swaps cells that aren't reversed already.
+
+#ifdef RECTANGLE_OPS
+
+// Rectangle from the last sequence, as rows (counting up from the bottom)
+// and columns, inclusive
+byte rect_lo, rect_hi, rect_left, rect_right;
+
+/** Read top;left;bottom;right from *s into rect_lo, rect_hi, rect_left,
+ *  rect_right, clipped to the screen. Returns FAIL if the rectangle is empty.
+ */
+int read_rectangle(const byte **s, byte *sep) {
+  uint16_t top    = next_csi_argument(s, sep);
+  uint16_t left   = next_csi_argument(s, sep);
+  uint16_t bottom = next_csi_argument(s, sep);
+  uint16_t right  = next_csi_argument(s, sep);
+  if (!top) top = 1;
+  if (!left) left = 1;
+  if (!bottom || bottom>TR) bottom = TR;
+  if (!right  || right >TC) right  = TC;
+  if (top>bottom || left>right) return FAIL;
+  rect_lo    = TR-bottom;
+  rect_hi    = TR-top;
+  rect_left  = left-1;
+  rect_right = right-1;
+  return SUCCESS;
+}
+
+/** Fill the rectangle with a character, in the current style (DECFRA) */
+void fill_rectangle(uint32_t code) {
+  byte r0=row, c0=col;
+  rep_code   = code;
+  rep_loaded = 0;
+  for (row=rect_lo; row<=rect_hi; row++) {
+    col = rect_left;
+    repeat_character(rect_right-rect_left+1);
+  }
+  row=r0; col=c0;
+  new_combining_ok = 0;
+}
+
+/** Erase the rectangle to the background color (DECERA) */
+void erase_rectangle() {
+  byte w = rect_right-rect_left+1;
+  tft.fillRect(rect_lo*CH,rect_left*CW,(rect_hi-rect_lo+1)*CH,w*CW,bg);
+  for (byte r=rect_lo; r<=rect_hi; r++) {
+    mark_cleared_for_blink(r*TC+rect_left,r*TC+rect_left+w);
+    cells_erase(r*TC+rect_left,r*TC+rect_left+w);
+  }
+}
+
+/** Copy the rectangle so that its top left corner is at row r, column c
+ *  (DECCRA). The source and destination may overlap. Each column of pixels
+ *  is read into copy_buffer, all rows at once, and written back. Columns
+ *  are copied starting from whichever end won't overwrite pixels that
+ *  haven't been read yet.
+ */
+void copy_rectangle(byte r, byte c) {
+  // Clip the destination to the screen
+  byte h = min(rect_hi-rect_lo, r)+1;
+  byte w = min(rect_right-rect_left+1, TC-c);
+  rect_lo = rect_hi+1-h;
+  byte dst_lo = r+1-h;
+  // Pixel rows, in the screen's x coordinate
+  byte    read_x  = rect_lo*CH;
+  byte    write_x = dst_lo*CH;
+  byte    npixels = h*CH;
+  boolean right   = c>rect_left;
+  unsigned int ncols = w*CW;
+  flush_cells();
+  for (unsigned int i=0; i<ncols; i++) {
+    unsigned int y = right? ncols-1-i : i;
+    SET_XY_RANGE(read_x,read_x+npixels-1,rect_left*CW+y);
+    tft.readPixels(npixels, copy_buffer);
+    SET_XY_RANGE(write_x,write_x+npixels-1,c*CW+y);
+    COMMAND(BEGIN_PIXEL_DATA);
+    for (byte j=0; j<npixels; j++) {
+      WRITE_BUS(copy_buffer[j]);
+      CLOCK_1;
+    }
+  }
+  // Copy the blink flags in the same order
+  boolean up = dst_lo>rect_lo;
+  for (byte i=0; i<h; i++) {
+    byte dr = up? h-1-i : i;
+    for (byte j=0; j<w; j++) {
+      byte dc = right? w-1-j : j;
+      copyblink(dst_lo+dr,c+dc,rect_lo+dr,rect_left+dc);
+    }
+  }
+  cells_unknown(dst_lo,dst_lo+h-1,c,c+w-1);
+}
+
+/** Recolor one character cell in place. The cell is read back, its most
+ *  common color taken as the background, and every other pixel as
+ *  foreground.
+ *  @param set_fg: if nonzero, foreground pixels become new_fg
+ *  @param set_bg: if nonzero, background pixels become new_bg
+ *  @param swap: if nonzero, exchange foreground and background
+ */
+void recolor_location(byte r, byte c,
+                      byte set_fg, byte new_fg, byte set_bg, byte new_bg,
+                      byte swap) {
+  byte x0 = r*CH;
+  unsigned int y0 = c*CW;
+  SET_Y_RANGE(y0,y0+CW-1);
+  SET_X_RANGE(x0,x0+CH-1);
+  tft.readPixels(CH*CW, copy_buffer);
+  // Majority vote for the background color
+  byte cell_bg = copy_buffer[0];
+  byte votes   = 0;
+  for (byte i=0; i<CH*CW; i++) {
+    if (!votes) {cell_bg = copy_buffer[i]; votes = 1;}
+    else if (copy_buffer[i]==cell_bg) votes++;
+    else votes--;
+  }
+  // For reverse video we need one foreground color. Blank cells have none,
+  // so use the current one.
+  byte cell_fg = fg;
+  for (byte i=0; i<CH*CW; i++)
+    if (copy_buffer[i]!=cell_bg) {cell_fg = copy_buffer[i]; break;}
+  byte to_fg = set_fg? new_fg : cell_fg;
+  byte to_bg = set_bg? new_bg : cell_bg;
+  // The box is tight, so writing starts again at its corner
+  COMMAND(BEGIN_PIXEL_DATA);
+  for (byte i=0; i<CH*CW; i++) {
+    byte p = copy_buffer[i];
+    if (p==cell_bg) p = swap? to_fg : to_bg;
+    else if (swap)  p = to_bg;
+    else if (set_fg) p = new_fg;
+    WRITE_BUS(p);
+    CLOCK_1;
+  }
+  RESET_Y_RANGE();
+}
+
+/** Set or clear the blink flag of cell (r,c) */
+void set_blinking(byte r, byte c, byte on) {
+  if (!on) BVEC_CLEAR(blinking,r,c);
+  else {
+    BVEC_SET(blinking,r,c);
+    blink_rows |= BLINK_ROW(r);
+  }
+}
+
+/** Recolor cell (r,c) for DECCARA or DECRARA: give it the new colors, and
+ *  reverse video if reverse is nonzero. A reversed cell shows its foreground
+ *  color as the background, and the blink machine may have it inverted.
+ */
+void restyle_location(byte r, byte c,
+                      byte set_fg, byte new_fg, byte set_bg, byte new_bg,
+                      byte reverse) {
+  // Restore the normal colors; the blink machine inverts them again if the
+  // cell still blinks
+  if (BVEC_GET(highlight,r,c)) {
+    invert_location(r,c);
+    BVEC_CLEAR(highlight,r,c);
+  }
+  byte swap = reverse!=BVEC_GET(reversed,r,c);
+  if (reverse) BVEC_SET(reversed,r,c); else BVEC_CLEAR(reversed,r,c);
+  if (!(set_fg || set_bg || swap)) return;
+  if (reverse) recolor_location(r,c,set_bg,new_bg,set_fg,new_fg,swap);
+  else         recolor_location(r,c,set_fg,new_fg,set_bg,new_bg,swap);
+}
+
+/** Change attributes in the rectangle (DECCARA).
+ *  s points to the SGR parameters following the rectangle.
+ */
+int change_rectangle_attributes(const byte *s) {
+  // Apply the SGR parameters to the registers, note what they set, then
+  // put the registers back as they were
+  byte saved[SGR_REGISTERS];
+  byte i;
+  for (i=0; i<SGR_REGISTERS; i++) saved[i] = *(byte*)pgm_read_ptr(&sgr_registers[i]);
+  sgr_changed = 0;
+  int result = apply_SGR(s);
+  byte set_fg  = (sgr_changed>>SGR_FG)&1;
+  byte set_bg  = (sgr_changed>>SGR_BG)&1;
+  byte set_rev = (sgr_changed>>SGR_INVERT)&1;
+  byte blink   = (sgr_changed>>SGR_BLINK)&1;
+  byte new_fg  = fg, new_bg = bg, new_rev = invert!=NORMAL, new_blink = blink_mode;
+  for (i=0; i<SGR_REGISTERS; i++) *(byte*)pgm_read_ptr(&sgr_registers[i]) = saved[i];
+  if (result==FAIL) return FAIL;
+  flush_cells();
+  cells_unknown(rect_lo,rect_hi,rect_left,rect_right);
+  for (byte r=rect_lo; r<=rect_hi; r++) for (byte c=rect_left; c<=rect_right; c++) {
+    byte reverse = set_rev? new_rev : BVEC_GET(reversed,r,c);
+    restyle_location(r,c,set_fg,new_fg,set_bg,new_bg,reverse);
+    if (blink) set_blinking(r,c,new_blink!=NORMAL);
+  }
+  return SUCCESS;
+}
+
+/** Reverse attributes in the rectangle (DECRARA).
+ *  s points to the attribute codes following the rectangle.
+ */
+int reverse_rectangle_attributes(const byte *s) {
+  byte sep, toggle_rev = 0, toggle_blink = 0;
+  do {
+    uint16_t p = next_csi_argument(&s, &sep);
+    if (p==0 || p==7) toggle_rev   = 1;
+    if (p==0 || p==5) toggle_blink = 1;
+  } while (sep);
+  flush_cells();
+  cells_unknown(rect_lo,rect_hi,rect_left,rect_right);
+  for (byte r=rect_lo; r<=rect_hi; r++) for (byte c=rect_left; c<=rect_right; c++) {
+    byte reverse = BVEC_GET(reversed,r,c)^toggle_rev;
+    restyle_location(r,c,0,0,0,0,reverse);
+    if (toggle_blink) set_blinking(r,c,!BVEC_GET(blinking,r,c));
+  }
+  return SUCCESS;
+}
+
+/** Handle CSI ... $ final, after the final byte has been received */
+int parse_rectangle_op() {
+  const byte *s = cs_param_buff;
+  byte sep;
+  int result = SUCCESS;
+  switch (cs_final_byte) {
+    case 'x': { // DECFRA
+      uint16_t code = next_csi_argument(&s, &sep);
+      if (!((32<=code && code<127) || (160<=code && code<256))) result = FAIL;
+      else if ((result=read_rectangle(&s,&sep))==SUCCESS) fill_rectangle(code);
+      } break;
+    case 'z': // DECERA
+      if ((result=read_rectangle(&s,&sep))==SUCCESS) erase_rectangle();
+      break;
+    case 'v': { // DECCRA
+      if ((result=read_rectangle(&s,&sep))==FAIL) break;
+      next_csi_argument(&s, &sep); // source page
+      uint16_t top  = next_csi_argument(&s, &sep);
+      uint16_t left = next_csi_argument(&s, &sep);
+      if (!top)  top  = 1;
+      if (!left) left = 1;
+      if (top>TR || left>TC) result = FAIL;
+      else copy_rectangle(TR-top,left-1);
+      } break;
+    case 'r': // DECCARA
+      if ((result=read_rectangle(&s,&sep))==SUCCESS)
+        result = change_rectangle_attributes(s);
+      break;
+    case 't': // DECRARA
+      if ((result=read_rectangle(&s,&sep))==SUCCESS)
+        result = reverse_rectangle_attributes(s);
+      break;
+    default: result = FAIL;
+  }
+  return result;
+}
+
+#endif // RECTANGLE_OPS
+
+#endif // RECTANGLES_H
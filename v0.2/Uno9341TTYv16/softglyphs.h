@@ -0,0 +1,124 @@
+#ifndef SOFTGLYPHS_H
+#define SOFTGLYPHS_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Glyphs uploaded by the host (DECDLD-style)
+//
+// Codepoints the font tables don't cover draw as the replacement character.
+// The host can upload 12x6 bitmaps for a few of them, with a device control
+// string in the style of DECDLD:
+//
+//   DCS Pcode ; Pe { sixels / sixels ; sixels / sixels ... ST
+//
+// Pcode is the codepoint (decimal) of the first glyph, and each ';' moves on
+// to the next codepoint. A glyph is two bands of six sixels (0x3F-0x7E, each
+// a column of 6 pixels, least significant bit at the top): the upper half of
+// the cell, then after '/', the lower half. Pe=2 erases all uploaded glyphs
+// first, as in DECDLD. A real DECDLD (which would load a soft character set)
+// starts with a small Pfn, and is skipped like any other DCS.
+//
+// load_unicode (fontmap.h) checks the SOFT_GLYPH_SLOTS slots before giving
+// up on a codepoint, so uploaded glyphs are styled and drawn like any other,
+// but can't replace glyphs the tables already have. Once the slots are full,
+// they are reused in turn. Characters already on screen aren't redrawn.
+
+#ifdef SOFT_GLYPHS
+
+// Codepoints bound to each slot (0 if free), and their bitmaps, rows from
+// the bottom as in char_bitmap
+uint32_t soft_glyph_codes[SOFT_GLYPH_SLOTS];
+byte     soft_glyph_bitmaps[SOFT_GLYPH_SLOTS][CH];
+byte     soft_glyph_next = 0; // Slot to reuse once all are taken
+
+// State of the upload in progress
+uint32_t soft_glyph_code  = 0; // Codepoint being loaded
+byte     soft_glyph_param = 0; // Which DCS parameter is being read
+byte     soft_glyph_erase = 0; // Pe
+byte     soft_glyph_slot  = 0; // Slot being loaded
+byte     soft_glyph_row   = 0; // Top row of the current band, from the top
+byte     soft_glyph_col   = 0; // Column of the next sixel
+
+/** Load the glyph bound to code into char_bitmap. Returns LOADED, or
+ *  NOT_IMPLEMENTED if there isn't one.
+ */
+int load_soft_glyph(uint32_t code) {
+  for (byte i=0; i<SOFT_GLYPH_SLOTS; i++) if (soft_glyph_codes[i]==code) {
+    memcpy(char_bitmap, soft_glyph_bitmaps[i], CH);
+    return LOADED;
+  }
+  return NOT_IMPLEMENTED;
+}
+
+/** Forget all uploaded glyphs */
+void clear_soft_glyphs() {
+  memset(soft_glyph_codes, 0, sizeof(soft_glyph_codes));
+  soft_glyph_next = 0;
+}
+
+/** Start loading the glyph for soft_glyph_code, in the slot it already has,
+ *  or else a free slot, or else the next one in turn.
+ */
+void start_soft_glyph() {
+  byte i;
+  for (i=0; i<SOFT_GLYPH_SLOTS; i++) if (soft_glyph_codes[i]==soft_glyph_code) break;
+  if (i==SOFT_GLYPH_SLOTS)
+    for (i=0; i<SOFT_GLYPH_SLOTS; i++) if (!soft_glyph_codes[i]) break;
+  if (i==SOFT_GLYPH_SLOTS) {
+    i = soft_glyph_next;
+    soft_glyph_next = (i+1)%SOFT_GLYPH_SLOTS;
+  }
+  soft_glyph_codes[i] = soft_glyph_code;
+  memset(soft_glyph_bitmaps[i], 0, CH);
+  soft_glyph_slot = i;
+  soft_glyph_row  = 0;
+  soft_glyph_col  = 0;
+}
+
+/** Begin the parameters of a DCS */
+void begin_soft_glyphs() {
+  soft_glyph_code  = 0;
+  soft_glyph_param = 0;
+  soft_glyph_erase = 0;
+}
+
+/** Handle a parameter byte of the DCS, a digit or ';' */
+void soft_glyph_parameter(byte c) {
+  if (c==';') {soft_glyph_param++; return;}
+  c -= '0';
+  if (soft_glyph_param==0 && soft_glyph_code<=0x10FFFF)
+    soft_glyph_code = soft_glyph_code*10+c;
+  if (soft_glyph_param==1) soft_glyph_erase = min(soft_glyph_erase*10+c,9);
+}
+
+/** Called at '{', the end of the DCS parameters. Returns FAIL if they don't
+ *  give a codepoint we can load.
+ */
+int soft_glyph_data_begins() {
+  if (soft_glyph_code<0xA0 || soft_glyph_code>0x10FFFF) return FAIL;
+  if (soft_glyph_erase==2) clear_soft_glyphs();
+  start_soft_glyph();
+  return SUCCESS;
+}
+
+/** Handle a byte of glyph data: a sixel, '/', or ';' */
+void soft_glyph_data(byte c) {
+  if (c==';') {
+    if (++soft_glyph_code<=0x10FFFF) start_soft_glyph();
+    else soft_glyph_row = CH; // Ignore the rest
+  }
+  else if (c=='/') {
+    if (soft_glyph_row<CH) soft_glyph_row += 6;
+    soft_glyph_col = 0;
+  }
+  else if (0x3F<=c && c<=0x7E && soft_glyph_col<CW && soft_glyph_row<CH) {
+    byte *bitmap = soft_glyph_bitmaps[soft_glyph_slot];
+    c -= 0x3F;
+    for (byte i=0; i<6; i++, c>>=1)
+      if (c&1) bitmap[CH-1-soft_glyph_row-i] |= 1<<soft_glyph_col;
+    soft_glyph_col++;
+  }
+}
+
+#endif // SOFT_GLYPHS
+
+#endif // SOFTGLYPHS_H
@@ -3,6 +3,15 @@
 
 #include "myfont.h"
 
+// The cell model (cells.h) follows the screen through these
+void cells_erase(unsigned int start, unsigned int end);
+void cells_reset();
+byte cells_scroll(byte lo, byte hi, int scroll_rows);
+void cells_shift(byte r, byte c, int n);
+void cells_drawn(byte n);
+void flush_cells_if_due();
+void clear_soft_glyphs(); // softglyphs.h
+
 ////////////////////////////////////////////////////////////////////////////////
 // Bulk drawing subroutines
 
@@ -58,12 +67,23 @@ void clear_left() {
   if (!col) return;
   tft.fillRect(row*CH,0,CH,col*CW,bg);
   mark_cleared_for_blink(row*TC,row*TC+col);
+  cells_erase(row*TC,row*TC+col);
 }
 
 /** Clear current column and columns to the right on the current row */
 void clear_right() {
   if (col*CW<SW) tft.fillRect(row*CH,col*CW,CH,SW-col*CW,bg);
   mark_cleared_for_blink(row*TC+col,row*TC+TC);
+  cells_erase(row*TC+col,row*TC+TC);
+}
+
+/** Clear n columns starting at the cursor, without moving it */
+void clear_chars(byte n) {
+  if (col>=TC) return;
+  n = min(n,TC-col);
+  tft.fillRect(row*CH,col*CW,CH,n*CW,bg);
+  mark_cleared_for_blink(row*TC+col,row*TC+col+n);
+  cells_erase(row*TC+col,row*TC+col+n);
 }
 
 /** Clear rows above the current one */
@@ -71,6 +91,7 @@ void clear_above() {
   if (row>=TR-1) return;
   tft.fillRect((row+1)*CH,0,(TR-1-row)*CH,SW,bg);
   mark_cleared_for_blink((row+1)*TC,TC*TR);
+  cells_erase((row+1)*TC,TC*TR);
 }
 
 /** Clear rows below the current one */
@@ -78,18 +99,21 @@ void clear_below() {
   if (!row) return;
   tft.fillRect(0,0,row*CH,SW,bg);
   mark_cleared_for_blink(0,row*TC);
+  cells_erase(0,row*TC);
 }
 
 /** Clear current line */ 
 void clear_line() {
   tft.fillRect(row*CH,0,CH,SW,bg);
   mark_cleared_for_blink(row*TC,row*TC+TC);
+  cells_erase(row*TC,row*TC+TC);
 }
 
 /** Clear screen */
 void clear_screen() {
   clear_blink(); 
   tft.fillScreen(bg);
+  cells_reset();
 }
 
 /** Clear screen and reset cursor */
@@ -99,27 +123,32 @@ void reset_screen() {
   col=0;
 }
 
-/** Scrolling is slow! */
-void scroll(int scroll_rows) {
+/** Scroll rows lo..hi (inclusive) by scroll_rows, up if positive, leaving
+ *  the rest of the screen alone. Rows scrolled in are cleared. 
+ *  Scrolling is slow! We read back each column of pixels, so the cost is 
+ *  proportional to the number of rows in the region. The cell model can 
+ *  sometimes redraw the rows later instead (see cells.h). 
+ */
+void scroll_region(byte lo, byte hi, int scroll_rows) {
   if (!scroll_rows) return;
-  scrollblink(scroll_rows);
-  if (scroll_rows>=TR || scroll_rows<=-TR) {reset_screen(); return;}
+  byte modeled = cells_scroll(lo,hi,scroll_rows);
+  scrollblink(lo,hi,scroll_rows);
+  byte shift = min(abs(scroll_rows),hi-lo+1);
   // Number of rows we'll need to copy
-  byte readrows   = (TR-abs(scroll_rows));
-  int  readpixels = readrows*CH;
+  byte readrows   = hi-lo+1-shift;
+  byte readpixels = readrows*CH;
   // Read columns one by one into this buffer
   boolean up = scroll_rows>0;
-  uint8_t read_start  = up ? 0                : -scroll_rows*CH;
-  uint8_t read_stop   = up ? readpixels       : SH-1;
-  uint8_t write_start = up ? CH*scroll_rows   : 0;
-  uint8_t write_stop  = SH-1;
-  uint8_t clear_start = up ? 0                : readpixels;
-  uint8_t clear_stop  = up ? scroll_rows*CH-1 : SH-1;
-  for (unsigned int col=0; col<SW; col++) 
+  uint8_t bottom      = lo*CH;
+  uint8_t top         = (hi+1)*CH-1;
+  uint8_t read_start  = up ? bottom          : bottom+shift*CH;
+  uint8_t write_start = up ? bottom+shift*CH : bottom;
+  uint8_t clear_start = up ? bottom          : bottom+readpixels;
+  if (readrows && !modeled) for (unsigned int col=0; col<SW; col++) 
   { 
-    SET_XY_RANGE(read_start,read_stop,col);
+    SET_XY_RANGE(read_start,top,col);
     tft.readPixels(readpixels, copy_buffer);
-    SET_X_RANGE(write_start,write_stop);
+    SET_X_RANGE(write_start,top);
     COMMAND(BEGIN_PIXEL_DATA);
     byte i=0;
     for (byte row=0; row<readrows; row++) { 
@@ -130,9 +159,100 @@ void scroll(int scroll_rows) {
         }
     }
   }
-  SET_X_RANGE(clear_start,clear_stop);
+  SET_X_RANGE(clear_start,clear_start+shift*CH-1);
   SET_Y_LOCATION(0);
-  tft.flood(bg,SW*abs(scroll_rows)*CH);
+  tft.flood(bg,(uint32_t)SW*shift*CH);
+  flush_cells_if_due();
+}
+
+/** Scroll the scrolling region, up if scroll_rows is positive */
+void scroll(int scroll_rows) {
+  scroll_region(margin_bottom,margin_top,scroll_rows);
+}
+
+/** Set the scrolling region (DECSTBM) to lines top..bottom, counting from 1
+ *  at the top of the screen. Zero means the edge of the screen. The cursor 
+ *  moves to the top left. 
+ */
+void set_margins(uint16_t top, uint16_t bottom) {
+  if (!top) top = 1;
+  if (!bottom || bottom>TR) bottom = TR;
+  if (top>=bottom) return;
+  margin_top    = TR-top;
+  margin_bottom = TR-bottom;
+  row = TR-1;
+  col = 0;
+}
+
+/** Insert n blank lines at the cursor row, pushing the lines below it down
+ *  (IL). Lines pushed past the bottom margin are lost. 
+ */
+void insert_lines(byte n) {
+  if (row<margin_bottom || row>margin_top) return;
+  scroll_region(margin_bottom,row,-(int)n);
+  col = 0;
+}
+
+/** Delete n lines starting at the cursor row, pulling the lines below it up
+ *  (DL). Blank lines are added at the bottom margin. 
+ */
+void delete_lines(byte n) {
+  if (row<margin_bottom || row>margin_top) return;
+  scroll_region(margin_bottom,row,n);
+  col = 0;
+}
+
+/** Move ncols pixel columns of the cursor row from y=from to y=to. This is
+ *  how we shift the tail of a line sideways. Columns go through copy_buffer 
+ *  a few at a time, starting from whichever end won't overwrite pixels that 
+ *  haven't been read yet. 
+ */
+#define COPY_COLUMNS (sizeof(copy_buffer)/CH)
+void move_row_pixels(unsigned int from, unsigned int to, unsigned int ncols) {
+  byte    x0    = row*CH;
+  boolean right = to>from;
+  while (ncols) {
+    byte n = min(ncols,COPY_COLUMNS);
+    ncols -= n;
+    // Moving right, work backwards from the end
+    unsigned int src = right? from+ncols : from;
+    unsigned int dst = right? to+ncols   : to;
+    if (!right) {from+=n; to+=n;}
+    SET_XY_RANGE(x0,x0+CH-1,src);
+    tft.readPixels(n*CH, copy_buffer);
+    SET_XY_RANGE(x0,x0+CH-1,dst);
+    COMMAND(BEGIN_PIXEL_DATA);
+    for (byte i=0; i<n*CH; i++) {
+      WRITE_BUS(copy_buffer[i]); 
+      CLOCK_1; 
+    }
+  }
+}
+
+/** Insert n blank cells at the cursor, pushing the rest of the line right 
+ *  (ICH). Characters pushed past the last column are lost. 
+ */
+void insert_chars(byte n) {
+  if (col>=TC) return;
+  n = min(n,TC-col);
+  cells_shift(row,col,n);
+  move_row_pixels(col*CW,(col+n)*CW,(TC-col-n)*CW);
+  shiftblink(row,col,n);
+  clear_chars(n);
+}
+
+/** Delete n cells at the cursor, pulling the rest of the line left (DCH). 
+ *  Blank cells are added at the end of the line. 
+ */
+void delete_chars(byte n) {
+  if (col>=TC) return;
+  n = min(n,TC-col);
+  cells_shift(row,col,-(int)n);
+  move_row_pixels((col+n)*CW,col*CW,(TC-col-n)*CW);
+  shiftblink(row,col,-(int)n);
+  tft.fillRect(row*CH,(TC-n)*CW,CH,n*CW,bg);
+  mark_cleared_for_blink(row*TC+TC-n,row*TC+TC);
+  cells_erase(row*TC+TC-n,row*TC+TC);
 }
 
 /** Store ("stash") current cursor location */
@@ -140,73 +260,176 @@ void save_cursor() {
   saved_row=row; saved_col=col;
 }
 
-/** Xor-draw the cursor at the current position. 
- *  Can be used to both add and erase the cursor.
+/** Set the drawing window to the cursor shape at cursor_row, cursor_col, 
+ *  for the current cursor style. Returns the number of pixels it covers.
  */
-void cstamp() { 
-  if (cursor_visible && col<TC)
-    tft.invertRect(row*CH, col*CW, 1, CW);
+byte cursor_window() {
+  byte         x0 = cursor_row*CH; // Bottom edge, in pixels
+  unsigned int y0 = cursor_col*CW; // Left edge
+  byte h = CH, w = CW;
+  switch (cursor_style) {
+    case 3: case 4: h = 1; break; // Underline
+    case 5: case 6: w = 1; break; // Bar
+  }
+  SET_Y_RANGE(y0,y0+w-1);
+  SET_X_RANGE(x0,x0+h-1);
+  return h*w;
+}
+
+/** The cursor is an overlay. Nothing that draws or moves the cursor needs
+ *  to think about it: loop() erases it before handling any input, and idle()
+ *  draws it again once input has gone quiet for CURSOR_DELAY ms. 
+ *  The pixels under the cursor are saved in cursor_under when it is drawn, 
+ *  so erasing it is a plain write, without reading the screen back. 
+ */
+void draw_cursor() {
+  if (cursor_drawn || !cursor_visible || sync_output || col>=TC) return;
+  cursor_row = row;
+  cursor_col = col;
+  byte n = cursor_window();
+  tft.readPixels(n, cursor_under);
+  START_PIXEL_DATA();
+  for (byte i=0; i<n; i++) {WRITE_BUS(~cursor_under[i]); CLOCK_1;}
+  RESET_Y_RANGE();
+  cursor_drawn = 1;
+}
+
+/** Erase the cursor, if it is on screen, restoring the pixels under it */
+void erase_cursor() {
+  if (!cursor_drawn) return;
+  byte n = cursor_window();
+  START_PIXEL_DATA();
+  for (byte i=0; i<n; i++) {WRITE_BUS(cursor_under[i]); CLOCK_1;}
+  RESET_Y_RANGE();
+  cursor_drawn = 0;
+}
+
+/** Called from idle() once input is quiet: show the cursor, or blink it */
+void update_cursor() {
+  if (!(cursor_style&1)) {draw_cursor(); return;}
+  if (((millis()-last_input)/CURSOR_BLINK)&1) erase_cursor();
+  else draw_cursor();
 }
 
 /** Restore cursor from stashed position */
 void restore_cursor() {
-  cstamp();  
   row=saved_row; col=saved_col; 
-  cstamp();  
 }
 
 /** Make cursor visible */
 void show_cursor() {
-  if (!cursor_visible) { cursor_visible=1; cstamp(); }
-  else cursor_visible = 1;
+  cursor_visible = 1;
 }
 
 /** Make cursor invisible */
 void hide_cursor() {
-  if (cursor_visible) cstamp();  
   cursor_visible = 0;
 }
 
+/** Begin synchronized output (CSI ? 2026 h). The host is about to redraw,
+ *  so leave the cursor off and pause the blink machine until end_sync(). 
+ */
+void begin_sync() {
+  if (sync_output) return;
+  sync_output = 1;
+  sync_start  = millis();
+}
+
+/** End synchronized output (CSI ? 2026 l); idle() puts the cursor back */
+void end_sync() {
+  sync_output = 0;
+}
+
 /** Backspace */
 void backspace() {
   if (!col) return;
-  cstamp(); 
   col--; 
   tft.fillRect(row*CH, col*CW, CH, CW, bg);
-  cstamp();
+  cells_erase(row*TC+col,row*TC+col+1);
 }
 
 /** Implement bell as screen flash */
 void bell() {
   COMMAND(ILI9341_INVERTON); 
-  bell_counter=0x7fff; 
+  bell_on = 1;
+  bell_counter = BELL_TICKS; 
 }
 
-/** Serial read, blocking until input is available */
-uint8_t blocking_read()  {
-  while (!Serial.available());
-  return Serial.read();
+/** Count the newlines waiting in the receive buffer that will reach the
+ *  bottom margin, up to limit.
+ *
+ *  uart_rx_newlines counts every LF in the buffer, including those after a
+ *  cursor movement, or inside an OSC or DCS string. Scrolling ahead for those
+ *  would scroll too far, so we only follow printable text, CR, LF and SGR,
+ *  and stop at anything else, as lookahead_scan does.
+ */
+byte newlines_ahead(byte limit) {
+  byte count = 0;
+  if (!uart_rx_newlines) return 0;
+  #ifdef LZ_INPUT
+  // The ring buffer doesn't follow on until the copy in progress is done
+  if (uart_lz_copy) return 0;
+  #endif
+  byte n = uart_available();
+  byte i = uart_rx_tail;
+  for (byte k=0; k<n && count<limit; k++, i=(i+1)&UART_RX_MASK) {
+    uint16_t t = uart_rx_buffer[i];
+    if (t==NEWLINE) count++;
+    else if ((0x20<=t && t<0x7F) || (0xA0<=t && (t<0xD800 || t>=0xE000))
+         ||  t==CARRIAGE_RETURN) continue;
+    else if (t==ESCAPE || t==CSI) {
+      // Only SGR (CSI m) keeps us on the same line
+      if (t==ESCAPE) {
+        if (++k>=n) break;
+        i = (i+1)&UART_RX_MASK;
+        if (uart_rx_buffer[i]!='[') break;
+      }
+      for (k++; k<n; k++) {
+        i = (i+1)&UART_RX_MASK;
+        t = uart_rx_buffer[i];
+        if (!(('0'<=t && t<='9') || t==';')) break;
+      }
+      if (k>=n || t!='m') break;
+    }
+    else break;
+  }
+  return count;
 }
 
-/** Advance to first column of next row, scrolling up if needed.
- *  Remainder of this row is filled with the current background color.
+/** Move down one row, scrolling the scrolling region up if the cursor is on
+ *  its bottom margin (IND).
  */
-void newline() {
+void index_down() {
   // Move down without scrolling if possible
-  if (row) row--;
+  if (row!=margin_bottom) {if (row) row--;}
   else {
-    // Scrolling is slow so we need to scroll multiple to keep up
-    int nscroll=8;
+    // Scrolling is slow so we need to scroll multiple to keep up. Scroll
+    // ahead for newlines already waiting in the receive buffer that will
+    // reach this margin, up to 8, or the whole region while a synchronized
+    // frame is being drawn.
+    int ahead=sync_output? TR : 8;
+    int nscroll=min(1+newlines_ahead(ahead-1),margin_top-margin_bottom+1);
     scroll(nscroll); 
-    row=nscroll-1;
+    row=margin_bottom+nscroll-1;
   } 
+}
+
+/** Move up one row, scrolling the scrolling region down if the cursor is on
+ *  its top margin (RI). 
+ */
+void index_up() {
+  if (row!=margin_top) {if (row<TR-1) row++;}
+  else scroll(-1);
+}
+
+/** Advance to first column of next row, scrolling up if needed.
+ */
+void newline() {
+  index_down();
   col=0;
 }
 
-/** Move cursor to next position, redrawing if needed, adding new line if needed
- *  This assumes that the current position has recently been drawn, so there is
- *  no need to "erase" the cursor there. Call "cstamp();" before calling this 
- *  routine if you need to xor-draw out the cursor before moving it.
+/** Move cursor to next position, adding new line if needed
  *  
  *  We don't automatically start a new line if the current line is full, only if
  *  we then continue to try to print. Filling the line, then sending \n, emits 
@@ -215,6 +438,7 @@ void newline() {
  */
 void advance_cursor(uint8_t n) {
   update_blink(row,col);
+  cells_drawn(n);
   // Tell the combining modifier code that it's OK to combine with the current
   // bitmap. Also tell it where to draw the combined character by saving the
   // current row and column. 
@@ -223,7 +447,6 @@ void advance_cursor(uint8_t n) {
   new_combining_ok = 1;
   col += n;
   if (col>TC) newline();
-  cstamp();
 }
 
 /** We don't immediately trigger a newline when adancing the cursor, but we
@@ -242,10 +465,11 @@ void printch(char c)  {
   prepare_cursor();
   //load_char_bitmap_11x5(font_6x12_glyphs+BYTESPERCHAR_GLYPHS*(c));
   load_unicode(c);
+  cell_code = c;
   
   drawCharFancy(CH*row,CW*col,fg,bg,font_weight,font_mode,HALFWIDTH);
   advance_cursor(1);
-  cstamp();
+  rep_loaded = 0;
 }
 
 /** Print null-terminated string
@@ -280,13 +504,22 @@ void clear_bitmap() {
 
 /** Reset terminal to initial state */
 void reset() {
+  memcpy_P(color_cycle, default_color_cycle, PALETTE_SIZE);
   reset_text_attributes(); 
+  margin_top=TR-1;
+  margin_bottom=0;
+  sync_output=0;
+  glyph_words=0;
+  #ifdef SOFT_GLYPHS
+  clear_soft_glyphs();
+  #endif
   cursor_visible=0; 
+  cursor_style=CURSOR_DEFAULT;
   combining_ok=0;
   reset_screen(); 
   clear_bitmap();
+  rep_code = rep_loaded = 0;
   clear_blink();
-  cstamp();
 }
 
 #endif // TERMINAL_MISC_H
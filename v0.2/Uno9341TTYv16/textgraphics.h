@@ -47,23 +47,9 @@ void blit_rowwise(unsigned int x, unsigned int y, byte charwidth, byte fg, byte
   */
   
   byte nb;
-  for (byte i=0; i<CW; i++) {
-    nb = (char_bitmap[ 0]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 1]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 2]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 3]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 4]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 5]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 6]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 7]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 8]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[ 9]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[10]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-    nb = (char_bitmap[11]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-  }
-  
-  // Faster but takes too much space
-  /*
+#ifdef PROFILE_UNROLLED_BLIT
+  // Faster but takes too much space; build profiles with flash to spare
+  // enable this (see build_profiles in prepare_fonts/CONFIG.py)
   nb = (char_bitmap[ 0]>>0)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
   nb = (char_bitmap[ 1]>>0)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
   nb = (char_bitmap[ 2]>>0)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
@@ -141,7 +127,22 @@ void blit_rowwise(unsigned int x, unsigned int y, byte charwidth, byte fg, byte
   nb = (char_bitmap[ 9]>>5)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
   nb = (char_bitmap[10]>>5)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
   nb = (char_bitmap[11]>>5)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
-  */
+#else
+  for (byte i=0; i<CW; i++) {
+    nb = (char_bitmap[ 0]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 1]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 2]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 3]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 4]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 5]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 6]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 7]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 8]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[ 9]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[10]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+    nb = (char_bitmap[11]>>i)&1; if (nb!=b) {WRITE_BUS(nb?fg:bg); b=nb;} CLOCK_1;
+  }
+#endif
   // Cost 116 with other code in loop. Try this flavor.
   
   
@@ -0,0 +1,459 @@
+#ifndef UART_H
+#define UART_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Interrupt-driven serial receive with XON/XOFF flow control
+//
+// Arduino's `Serial` has a 64-byte receive buffer and no flow control, so
+// bytes arriving during a long scroll or screen capture were lost. Here the
+// sketch owns the USART receive interrupt. It decodes utf-8 as bytes arrive,
+// overlapping with drawing, and puts 16-bit tokens into a ring buffer sized 
+// from UART_SRAM_BUDGET:
+//   0x0000-0xD7FF, 0xE000-0xFFFF  a codepoint, including C0 controls, and the
+//                                 C1 controls 0x80-0x9F sent as single bytes
+//   0xD800-0xDBFF + 0xDC00-0xDFFF a codepoint past U+FFFF, as a utf-16 
+//                                 surrogate pair, always pushed together
+//   0xDC00|byte on its own        a byte that isn't valid utf-8
+// In ISO-8859-1 mode (ESC % @) bytes 0xA0-0xFF are characters in their own 
+// right, and aren't decoded.
+// The interrupt also counts newlines waiting in the buffer, so that scrolling
+// can be batched (see newline() in terminal_misc.h).
+//
+// XOFF is sent once the buffer holds UART_XOFF_LEVEL tokens, and XON once it 
+// has drained to UART_XON_LEVEL. Hardware overruns (DOR0) and tokens dropped
+// because the ring buffer was full are counted, and reported by the private 
+// query CSI ? 900 n (see control.h).
+//
+// Transmission is polled: we only send short replies and screen captures.
+//
+// The host can move to a faster rate (up to 1M baud) at runtime with a 
+// handshake, and we fall back to the boot rate if it doesn't complete.
+// test_terminal/baudprobe.cpp uses this to find the fastest reliable rate.
+//
+// With LZ_INPUT defined, CSI ? 904 h starts compressed input (spotted here,
+// like ESC % @). The bytes that follow are utf-8 as usual, except that
+// 0xFF (never valid utf-8) starts a record:
+//   0xFF 0x00            end of compressed input
+//   0xFF 0x01            a literal 0xFF byte (for ISO-8859-1)
+//   0xFF length distance copy length (2-255) tokens, starting distance+1 
+//                        tokens back
+// A copy goes into the ring buffer as two tokens, TOKEN_LZ_LENGTH|length and
+// TOKEN_LZ_DISTANCE|distance, and uart_read() expands it from a window of 
+// the last LZ_WINDOW tokens it returned. So the interrupt does no more work
+// per byte than before, and flow control still counts what was received. 
+// The window holds tokens rather than bytes, so a copy is always whole 
+// characters, and needs no further decoding. test_terminal/lzencode.cpp 
+// compresses text this way, and measures the effect on throughput.
+// Don't use `Serial` as well, its interrupt handlers clash with these.
+
+// Bytes of state besides the ring buffer itself
+#define UART_STATE_BYTES (18)
+
+// The ring buffer gets the largest power of two tokens that fits the SRAM 
+// budget, so that indecies can wrap with a mask
+#if   UART_SRAM_BUDGET >= 256+UART_STATE_BYTES
+  #define UART_RX_SIZE (128)
+#elif UART_SRAM_BUDGET >= 128+UART_STATE_BYTES
+  #define UART_RX_SIZE  (64)
+#elif UART_SRAM_BUDGET >=  64+UART_STATE_BYTES
+  #define UART_RX_SIZE  (32)
+#else
+  #define UART_RX_SIZE  (16)
+#endif
+#define UART_RX_MASK (UART_RX_SIZE-1)
+
+// Token ranges, see above
+#define TOKEN_HIGH_SURROGATE (0xD800)
+#define TOKEN_LOW_SURROGATE  (0xDC00)
+#define TOKEN_BAD_BYTE       (0xDC00)
+#define TOKEN_SURROGATE_MASK (0xFC00)
+
+#if UART_XOFF_LEVEL>=UART_RX_SIZE || UART_XON_LEVEL>=UART_XOFF_LEVEL
+  #error "Need UART_XON_LEVEL < UART_XOFF_LEVEL < UART_RX_SIZE"
+#endif
+
+// Private status query/report: CSI ? 900 n → CSI ? 900 ; overruns ; dropped ; peak n
+#define UART_STATUS_REPORT (900)
+// Private baud rate switch: CSI ? 901 ; <baud/100> p, see uart_switch_baud()
+#define UART_SWITCH_BAUD   (901)
+// Private mode for compressed input, see above
+#define LZ_MODE            (904)
+
+volatile uint16_t uart_rx_buffer[UART_RX_SIZE];
+volatile byte     uart_rx_head = 0;      // Next slot written by the interrupt
+volatile byte     uart_rx_tail = 0;      // Next slot read by the main loop
+volatile byte     uart_rx_peak = 0;      // Most tokens ever waiting in the buffer
+volatile byte     uart_rx_newlines = 0;  // NEWLINE tokens waiting in the buffer
+volatile byte     uart_xoff_sent = 0;    // Host has been asked to pause
+volatile byte     uart_flow_pending = 0; // XON/XOFF waiting for the transmitter
+volatile uint16_t uart_overruns = 0;     // Bytes lost in hardware (DOR0)
+volatile uint16_t uart_dropped  = 0;     // Tokens lost to a full ring buffer
+
+// utf-8 decoder state, only used by the receive interrupt
+byte     uart_utf8_remaining = 0; // Continuation bytes still expected
+byte     uart_utf8_lead      = 0; // First byte of the sequence
+uint32_t uart_utf8_code      = 0; // Codepoint bits received so far
+
+// Single-byte ISO-8859-1 mode, selected with ESC % @ and left with ESC % G.
+// These are spotted here rather than in the parser, as bytes following them
+// may already be decoded by the time the parser sees them.
+byte     uart_latin1     = 0;
+byte     uart_docs_match = 0; // How much of ESC % we've just seen
+
+#ifdef LZ_INPUT
+#if LZ_WINDOW>256 || (LZ_WINDOW&(LZ_WINDOW-1))
+  #error "LZ_WINDOW must be a power of two, at most 256"
+#endif
+#define LZ_WINDOW_MASK (LZ_WINDOW-1)
+#define LZ_MARK        (0xFF)
+#define TOKEN_LZ_LENGTH   (0xDD00)
+#define TOKEN_LZ_DISTANCE (0xDE00)
+// What the receive interrupt expects next
+#define LZ_OFF      (0) // Uncompressed input
+#define LZ_LITERAL  (1) // Input bytes, or LZ_MARK
+#define LZ_LENGTH   (2) // The byte after LZ_MARK
+#define LZ_DISTANCE (3) // The distance of a copy
+
+// Used by the receive interrupt
+const char uart_lz_begin[] PROGMEM = "\x1b[?904h";
+volatile byte uart_lz_state  = LZ_OFF;
+byte          uart_lz_match  = 0; // How much of uart_lz_begin we've just seen
+byte          uart_lz_length = 0; // Length of the copy being received
+// Used by uart_read()
+uint16_t uart_lz_window[LZ_WINDOW]; // The last tokens read
+byte     uart_lz_pos  = 0; // Where the next token read goes in the window
+byte     uart_lz_from = 0; // Where the copy in progress reads from
+byte     uart_lz_copy = 0; // Tokens of the copy still to read
+byte     uart_lz_pair = 0; // The last token from the ring was a high surrogate
+#endif
+
+/** Number of tokens waiting in the ring buffer */
+inline byte uart_available() {
+  return (byte)(uart_rx_head-uart_rx_tail) & UART_RX_MASK;
+}
+
+/** Whether uart_read() has a token to give */
+inline byte uart_ready() {
+  #ifdef LZ_INPUT
+  if (uart_lz_copy) return 1;
+  #endif
+  return uart_available();
+}
+
+/** The next token uart_read() will give, without taking it, or 0xFFFF if 
+ *  there isn't one yet (or it's at the start of a compressed copy)
+ */
+inline uint16_t uart_peek() {
+  #ifdef LZ_INPUT
+  if (uart_lz_copy) return uart_lz_window[uart_lz_from & LZ_WINDOW_MASK];
+  if (uart_available() 
+  && (uart_rx_buffer[uart_rx_tail]&0xFF00)==TOKEN_LZ_LENGTH) return 0xFFFF;
+  #endif
+  return uart_available()? uart_rx_buffer[uart_rx_tail] : 0xFFFF;
+}
+
+/** Send XON/XOFF ahead of any other output. If the transmitter is busy, the
+ *  data-register-empty interrupt sends it as soon as possible.
+ *  Call with interrupts disabled.
+ */
+void uart_send_flow(byte c) {
+  if (UCSR0A & _BV(UDRE0)) {
+    // Clear transmit-complete, as in uart_write
+    UCSR0A = (UCSR0A & _BV(U2X0)) | _BV(TXC0);
+    UDR0 = c;
+  }
+  else {
+    uart_flow_pending = c;
+    UCSR0B |= _BV(UDRIE0);
+  }
+}
+
+/** Add tokens to the ring buffer, from the receive interrupt. A surrogate
+ *  pair goes in whole or not at all.
+ */
+void uart_push(uint16_t t) {
+  byte next = (uart_rx_head+1) & UART_RX_MASK;
+  if (next==uart_rx_tail) {
+    if (uart_dropped!=0xFFFF) uart_dropped++;
+    return;
+  }
+  uart_rx_buffer[uart_rx_head] = t;
+  uart_rx_head = next;
+  if (t==NEWLINE) uart_rx_newlines++;
+}
+void uart_push_pair(uint16_t hi, uint16_t lo) {
+  if (uart_available()>=UART_RX_MASK-1) {
+    if (uart_dropped!=0xFFFF) uart_dropped++;
+    return;
+  }
+  uart_push(hi);
+  uart_push(lo);
+}
+
+/** Decode one received byte, pushing a token if it completes a character.
+ *  Overlong encodings, encoded surrogates, and codes past U+10FFFF are bad.
+ */
+void uart_decode(byte c) {
+  #ifdef LZ_INPUT
+  if (uart_lz_state==LZ_LITERAL) {
+    if (c==LZ_MARK) {uart_lz_state = LZ_LENGTH; return;}
+  }
+  else if (uart_lz_state==LZ_LENGTH) {
+    uart_lz_state = LZ_LITERAL;
+    if (c==0) {uart_lz_state = LZ_OFF; return;}
+    if (c!=1) {uart_lz_length = c; uart_lz_state = LZ_DISTANCE; return;}
+    c = LZ_MARK;
+  }
+  else if (uart_lz_state==LZ_DISTANCE) {
+    uart_push_pair(TOKEN_LZ_LENGTH|uart_lz_length, TOKEN_LZ_DISTANCE|c);
+    uart_lz_state = LZ_LITERAL;
+    return;
+  }
+  else {
+    // Watch for CSI ? 904 h, which still goes to the parser
+    if (c==pgm_read_byte(uart_lz_begin+uart_lz_match)) {
+      if (!pgm_read_byte(uart_lz_begin+ ++uart_lz_match)) {
+        uart_lz_state = LZ_LITERAL;
+        uart_lz_match = 0;
+      }
+    }
+    else uart_lz_match = c==ESCAPE;
+  }
+  #endif
+  // Watch for ESC % @ (ISO-8859-1) and ESC % G (utf-8)
+  if (uart_docs_match==2) {
+    if (c=='@') uart_latin1 = 1;
+    if (c=='G') uart_latin1 = 0;
+  }
+  uart_docs_match = c==ESCAPE? 1 : (uart_docs_match==1 && c=='%')? 2 : 0;
+  if (uart_latin1) {uart_push(c); return;}
+  if (uart_utf8_remaining) {
+    if ((c>>6)==0b10) {
+      uart_utf8_code = (uart_utf8_code<<6)|(c&0b111111);
+      if (--uart_utf8_remaining) return;
+      uint32_t code = uart_utf8_code;
+      if (uart_utf8_lead>=0xF0) {
+        if (code<0x10000 || code>0x10FFFF) uart_push(TOKEN_BAD_BYTE|uart_utf8_lead);
+        else {
+          code -= 0x10000;
+          uart_push_pair(TOKEN_HIGH_SURROGATE|(uint16_t)(code>>10),
+                         TOKEN_LOW_SURROGATE |(uint16_t)(code&0x3FF));
+        }
+      }
+      else if ((uart_utf8_lead>=0xE0 && code<0x800) || (code>=0xD800 && code<=0xDFFF))
+        uart_push(TOKEN_BAD_BYTE|uart_utf8_lead);
+      else uart_push(code);
+      return;
+    }
+    // Truncated sequence: flag it, then decode this byte afresh
+    uart_utf8_remaining = 0;
+    uart_push(TOKEN_BAD_BYTE|uart_utf8_lead);
+  }
+  // ASCII, C0 and C1 controls go through as they are
+  if (c<0xA0) {uart_push(c); return;}
+  uart_utf8_lead = c;
+  if      (c>=0xC2 && c<0xE0) {uart_utf8_code=c & 0b11111; uart_utf8_remaining=1;}
+  else if (c>=0xE0 && c<0xF0) {uart_utf8_code=c &  0b1111; uart_utf8_remaining=2;}
+  else if (c>=0xF0 && c<0xF5) {uart_utf8_code=c &   0b111; uart_utf8_remaining=3;}
+  else uart_push(TOKEN_BAD_BYTE|c); // Stray continuation byte, or invalid lead
+}
+
+ISR(USART_RX_vect) {
+  // Status must be read before the data register
+  byte status = UCSR0A;
+  byte c      = UDR0;
+  if ((status & _BV(DOR0)) && uart_overruns!=0xFFFF) uart_overruns++;
+  uart_decode(c);
+  byte used = uart_available();
+  if (used>uart_rx_peak) uart_rx_peak = used;
+  if (!uart_xoff_sent && used>=UART_XOFF_LEVEL) {
+    uart_send_flow(XOFF);
+    uart_xoff_sent = 1;
+  }
+}
+
+ISR(USART_UDRE_vect) {
+  UCSR0A = (UCSR0A & _BV(U2X0)) | _BV(TXC0);
+  UDR0 = uart_flow_pending;
+  uart_flow_pending = 0;
+  UCSR0B &= ~_BV(UDRIE0);
+}
+
+/** Take the next token from the ring buffer. Check uart_available() first.
+ *  Sends XON once the buffer has drained, if we sent XOFF earlier.
+ */
+uint16_t uart_take() {
+  uint16_t t = uart_rx_buffer[uart_rx_tail];
+  byte sreg = SREG;
+  cli();
+  uart_rx_tail = (uart_rx_tail+1) & UART_RX_MASK;
+  if (t==NEWLINE) uart_rx_newlines--;
+  if (uart_xoff_sent && uart_available()<=UART_XON_LEVEL) {
+    uart_send_flow(XON);
+    uart_xoff_sent = 0;
+  }
+  SREG = sreg;
+  return t;
+}
+
+/** Take the next token of input. Check uart_ready() first. */
+uint16_t uart_read() {
+  #ifdef LZ_INPUT
+  uint16_t t;
+  if (uart_lz_copy) uart_lz_copy--;
+  else {
+    t = uart_take();
+    // The second half of a surrogate pair could look like a copy
+    if ((t&0xFF00)!=TOKEN_LZ_LENGTH || uart_lz_pair) {
+      uart_lz_pair = (t&TOKEN_SURROGATE_MASK)==TOKEN_HIGH_SURROGATE;
+      uart_lz_window[uart_lz_pos++ & LZ_WINDOW_MASK] = t;
+      return t;
+    }
+    uart_lz_copy = (byte)t-1;
+    uart_lz_from = uart_lz_pos-1-(byte)uart_take();
+  }
+  t = uart_lz_window[uart_lz_from++ & LZ_WINDOW_MASK];
+  uart_lz_window[uart_lz_pos++ & LZ_WINDOW_MASK] = t;
+  return t;
+  #else
+  return uart_take();
+  #endif
+}
+
+/** Send one byte, waiting for the transmitter (and any pending XON/XOFF) */
+void uart_write(byte c) {
+  while (1) {
+    byte sreg = SREG;
+    cli();
+    if (!uart_flow_pending && (UCSR0A & _BV(UDRE0))) {
+      // Clear transmit-complete (by writing 1) for uart_flush_tx
+      UCSR0A = (UCSR0A & _BV(U2X0)) | _BV(TXC0);
+      UDR0 = c;
+      SREG = sreg;
+      return;
+    }
+    SREG = sreg;
+  }
+}
+
+/** Send a null-terminated string */
+void uart_print(const char *s) {
+  while (*s) uart_write(*s++);
+}
+
+/** Send an unsigned integer in decimal, without leading zeros */
+void uart_write_uint(uint16_t value) {
+  char digits[6];
+  byte i = 0;
+  do {digits[i++] = '0'+value%10; value/=10;} while (value);
+  while (i) uart_write(digits[--i]);
+}
+
+/** Choose the baud rate divisor, in normal (16 samples per bit) or U2X 
+ *  double-speed (8 samples per bit) mode, whichever is closer to the requested
+ *  rate. Normal mode wins ties, as it samples each bit more often. At 16MHz 
+ *  this gives exact rates for 250k, 500k and 1M baud, and U2X for 57600 and
+ *  115200 (-0.8% and +2.1%, against +2.1% and -3.5% in normal mode).
+ *  Returns UBRR with bit 15 set for U2X, or UART_NO_BAUD if the error would 
+ *  exceed UART_MAX_ERROR (tenths of a percent).
+ */
+#define UART_BAUD_U2X (0x8000)
+#define UART_NO_BAUD  (0xFFFF)
+uint16_t uart_baud_setting(unsigned long baud) {
+  if (baud==0) return UART_NO_BAUD;
+  unsigned long best_error = 0xFFFFFFFF;
+  uint16_t      setting    = UART_NO_BAUD;
+  for (byte u2x=0; u2x<2; u2x++) {
+    unsigned long clock = F_CPU/(u2x? 8:16);
+    unsigned long ubrr  = (clock+baud/2)/baud; // Divisor is UBRR+1
+    if (ubrr<1 || ubrr>4096) continue;
+    unsigned long rate  = clock/ubrr;
+    unsigned long error = rate>baud? rate-baud : baud-rate;
+    if (error<best_error) {
+      best_error = error; 
+      setting    = (ubrr-1) | (u2x? UART_BAUD_U2X : 0);
+    }
+  }
+  if (best_error*1000/baud>UART_MAX_ERROR) return UART_NO_BAUD;
+  return setting;
+}
+
+/** Load a setting from uart_baud_setting(); the transmitter should be idle */
+void uart_apply_baud(uint16_t setting) {
+  UCSR0A = (setting & UART_BAUD_U2X)? _BV(U2X0) : 0;
+  UBRR0  = setting & ~UART_BAUD_U2X;
+}
+
+/** Discard anything received, e.g. noise while changing baud rate */
+void uart_flush_rx() {
+  byte sreg = SREG;
+  cli();
+  uart_rx_tail = uart_rx_head;
+  uart_rx_newlines = 0;
+  uart_utf8_remaining = 0;
+  uart_xoff_sent = 0;
+  #ifdef LZ_INPUT
+  uart_lz_state = uart_lz_match = uart_lz_copy = uart_lz_pair = 0;
+  #endif
+  SREG = sreg;
+}
+
+/** Wait until everything written has left the transmitter */
+void uart_flush_tx() {
+  while (uart_flow_pending || !(UCSR0A & _BV(TXC0)));
+}
+
+/** Configure the USART for 8N1 at the given baud rate and start receiving */
+void uart_begin(unsigned long baud) {
+  uart_apply_baud(uart_baud_setting(baud));
+  UCSR0C = _BV(UCSZ01)|_BV(UCSZ00);
+  uart_rx_head = uart_rx_tail = uart_rx_newlines = 0;
+  uart_utf8_remaining = uart_latin1 = uart_docs_match = 0;
+  uart_xoff_sent = uart_flow_pending = 0;
+  #ifdef LZ_INPUT
+  uart_lz_state = uart_lz_match = uart_lz_copy = uart_lz_pair = 0;
+  #endif
+  UCSR0B = _BV(RXEN0)|_BV(TXEN0)|_BV(RXCIE0);
+  // In case the host was paused by a previous session
+  uart_write(XON);
+}
+
+/** Change baud rate at the host's request, CSI ? 901 ; <baud/100> p
+ *  1. If the rate can't be reached we reply NAK and stay put.
+ *  2. Otherwise we reply ACK at the old rate, and switch once it has gone.
+ *  3. The host switches too, and sends ENQ at the new rate; we reply ACK.
+ *  If no ENQ arrives within UART_SWITCH_TIMEOUT ms we go back to the boot
+ *  rate, BAUDRATE, and so should the host.
+ */
+byte uart_switch_baud(unsigned long baud) {
+  uint16_t setting = uart_baud_setting(baud);
+  if (setting==UART_NO_BAUD) {
+    uart_write(NEGATIVE_ACK);
+    return FAIL;
+  }
+  uart_write(ACKNOWLEDGEMENT);
+  uart_flush_tx();
+  uart_apply_baud(setting);
+  uart_flush_rx();
+  unsigned long start = millis();
+  while (millis()-start < UART_SWITCH_TIMEOUT) {
+    if (uart_available() && uart_read()==ENQUIRY) {
+      uart_write(ACKNOWLEDGEMENT);
+      return SUCCESS;
+    }
+  }
+  uart_apply_baud(uart_baud_setting(BAUDRATE));
+  uart_flush_rx();
+  return FAIL;
+}
+
+/** Reply to CSI ? 900 n with the receive error counters */
+void uart_status_report() {
+  uart_print("\x1b[?");
+  uart_write_uint(UART_STATUS_REPORT); uart_write(';');
+  uart_write_uint(uart_overruns);      uart_write(';');
+  uart_write_uint(uart_dropped);       uart_write(';');
+  uart_write_uint(uart_rx_peak);       uart_write('n');
+}
+
+#endif //UART_H
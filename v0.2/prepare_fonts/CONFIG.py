@@ -16,6 +16,7 @@ glyphcodes_filename         = sketchdir+os.sep+'glyphcodes.h'
 terminal_constants_filename = sketchdir+os.sep+'terminal_constants.h'
 diacritics_filename         = sketchdir+os.sep+'combining_diacritics.h'
 unicode_blocks_filename     = sketchdir+os.sep+'unicode_blocks.h'
+build_profile_filename      = sketchdir+os.sep+'build_profile.h'
 
 # The main font: image with its bitmaps, textfile with corresponding unicode characters
 main_glyph_image_filename = './bitmaps/glyphs.png'
@@ -48,6 +49,15 @@ unicode_block_information_file = './fontdescription/unicode_blocks.txt'
 # It also specifies the padding between the character and the modifier.
 combining_modifiers_file = './fontdescription/combining_modifiers_bitmaps.txt'
 
+# Optional: a utf-8 capture of typical terminal output (e.g. from `script`).
+# The table layout optimizer weights its cost model by how often each 
+# codepoint appears here. Set to None to weight all mapped codepoints equally.
+codepoint_profile_filename = None
+
+# Flash and cycle estimates for each build profile (see below) are collected
+# here, one line per profile, each time the unicode mapping is generated.
+profile_report_filename = './build_profiles.txt'
+
 # In case we're not being loaded from the prepare_fonts directory..
 import os
 here                              = os.path.dirname(__file__) + os.sep
@@ -58,6 +68,8 @@ glyphcodes_filename               = os.path.abspath(here + glyphcodes_filename)
 terminal_constants_filename       = os.path.abspath(here + terminal_constants_filename)
 diacritics_filename               = os.path.abspath(here + diacritics_filename)
 unicode_blocks_filename           = os.path.abspath(here + unicode_blocks_filename)
+build_profile_filename            = os.path.abspath(here + build_profile_filename)
+profile_report_filename           = os.path.abspath(here + profile_report_filename)
 main_glyph_image_filename         = os.path.abspath(here + main_glyph_image_filename)
 main_glyph_unicode_points         = os.path.abspath(here + main_glyph_unicode_points)
 boxdrawing_image_filename         = os.path.abspath(here + boxdrawing_image_filename)
@@ -66,6 +78,8 @@ character_decompositions_filename = os.path.abspath(here + character_decompositi
 glyph_aliases_filename            = os.path.abspath(here + glyph_aliases_filename)
 unicode_block_information_file    = os.path.abspath(here + unicode_block_information_file)
 combining_modifiers_file          = os.path.abspath(here + combining_modifiers_file)
+if codepoint_profile_filename is not None:
+  codepoint_profile_filename      = os.path.abspath(here + codepoint_profile_filename)
 
 # Width and height of terminal cells for each characters
 # This is the FULL width and height; alphanumeric glyphs should
@@ -113,6 +127,25 @@ CHARMASK = MAXNCHAR-1
 # Mask to extra transformation code from packed uint16
 COMMANDMASK = (MAXNMODS-1)*MAXNCHAR
 
+# Flash budget (bytes) for the codepoint mapping tables and packed glyph 
+# bitmaps. The table layout optimizer picks DENSE/SPARSE encodings and glyph
+# groupings that minimise expected lookup cycles within this budget. Set to 
+# None to use no more flash than the plain fixed-rule layout would. 
+layout_flash_budget = None
+
+# Store glyph groups as a dictionary of distinct pixel rows plus packed row
+# indecies, for groups where this is smaller than the raw bitmaps.
+compress_glyph_groups = False
+
+# Search for base glyphs that an existing transform command (reflection or
+# overlay) reproduces from another base glyph, and store these as transforms.
+discover_transforms = True
+
+# Flash budget (bytes) for baking the most frequent transformed glyphs, per the
+# codepoint profile, into plain bitmaps. These then skip the transform code at 
+# draw time. Needs a codepoint profile; set to 0 to disable.
+bake_flash_budget = 512
+
 # Prefix G_ should prevent collisions with other #defines in the C source
 glyph_code_prefix     = 'G_'
 transform_code_prefix = 'T_'
@@ -208,9 +241,43 @@ softmapped    = [s.lower().replace(' ','').replace('-','')
     for s in softmapped   ]
 
 
-
-
-
-
-
-
+################################################################################
+# Build profiles
+# A profile keeps only some of the blocks above (mapped and soft-mapped). This 
+# drops their mapping tables, any base glyphs that only they use, and their 
+# soft-font functions (the linker removes these once softmap_functions no
+# longer refers to them). If the profile sets `font_flash_budget`, flash for 
+# the font data that the remaining blocks don't need is spent on fast paths, 
+# in order of estimated cycles saved per byte:
+#  - ASCII_TABLE:    raw bitmaps for printable ASCII, skipping all lookups
+#  - PAGE_TABLE:     a codepoint page → block table, instead of a binary search
+#  - UNROLLED_BLIT:  fully unrolled blit_rowwise in textgraphics.h
+# Any flash left over goes to the layout optimizer (DENSE mapping tables). 
+# 
+# Select a profile with the TTY_PROFILE environment variable, e.g.
+#   TTY_PROFILE=latin ./prepare_all.sh
+# The full build uses about 10.5 kB for font data (mapping tables and glyph
+# bitmaps), so subset profiles are given the same budget. 
+build_profiles = {
+'full': dict(),
+'latin': dict(
+  blocks = [
+    'basiclatin','latin1supplement','latinextendeda','latinextendedb',
+    'latinextendedadditional','spacingmodifierletters','generalpunctuation',
+    'superscriptsandsubscripts','currencysymbols','letterlikesymbols',
+    'arrows','mathematicaloperators','miscellaneoustechnical',
+    'geometricshapes','boxdrawing','blockelements','combiningdiacriticalmarks'],
+  font_flash_budget = 10500),
+'ascii': dict(
+  blocks = ['basiclatin','boxdrawing','blockelements'],
+  font_flash_budget = 10500),
+}
+build_profile = os.environ.get('TTY_PROFILE','full')
+if not build_profile in build_profiles:
+  raise ValueError('Unknown build profile %s (TTY_PROFILE); expected one of %s'%(
+    build_profile,', '.join(build_profiles)))
+profile_blocks    = build_profiles[build_profile].get('blocks',None)
+font_flash_budget = build_profiles[build_profile].get('font_flash_budget',None)
+if profile_blocks is not None:
+  mapped_blocks = [s for s in mapped_blocks if s in profile_blocks]
+  softmapped    = [s for s in softmapped    if s in profile_blocks]
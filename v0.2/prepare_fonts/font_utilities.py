@@ -6,6 +6,8 @@ from matplotlib.image import imread
 import numpy as np
 from pylab import *
 import unicodedata
+import re
+import builtins
 from CONFIG import *
 
 ################################################################################
@@ -288,13 +290,14 @@ def bitpack_row(r):
   
 
 ################################################################################
-def pack_array(data,name):
+def pack_array(data,name,t=None):
   '''
-  Generate source code to pack array data in C static const array
+  Generate source code to pack array data in C static const array. The C
+  type is guessed from the data, unless given as t.
   '''
   data = array(data).ravel()
-  t = None
-  if   all((data>=     0)&(data<  256)): t='byte'
+  if   t is not None: pass
+  elif all((data>=     0)&(data<  256)): t='byte'
   elif all((data>=  -128)&(data<  128)): t='int8_t'
   elif all((data>=     0)&(data<65536)): t='unsigned int'
   elif all((data>=-32768)&(data<32768)): t='int'
@@ -419,3 +422,464 @@ def generate_codepoint_name_abbreviation(c, aliases, abbreviation_map):
         ])
     
     return shortname, name
+
+################################################################################
+# Cost model for table layouts
+# 
+# These are rough cycle counts for the AVR lookup routines in fontmap.h, 
+# counted from the generated assembly (-Os, ATmega328P). They don't need to be
+# exact: they are only used to rank candidate layouts against each other.
+# 
+# handle_unicode_mapping_table: first/last range check, bstart_indecies and 
+# codepoint_map reads, plus call overhead.
+CYCLES_TABLE_LOOKUP   = 40
+# Sparse blocks additionally read sparse_nmapped and sparse_offsets, and call
+# binary_search; each iteration of the search costs roughly this much.
+CYCLES_SPARSE_SETUP   = 20
+CYCLES_SPARSE_ITER    = 25
+# load_glyph_bitmap: one iteration of binary_search_range over glyph groups
+CYCLES_GROUP_ITER     = 35
+# load_rowpacked_glyph: setup (multiply, group table reads, clearing rows)
+CYCLES_UNPACK_SETUP   = 60
+# load_rowpacked_glyph: per packed row, excluding variable shifts
+CYCLES_UNPACK_ROW     = 20
+# Second byte read for glyphs that straddle a byte boundary
+CYCLES_UNPACK_SPLIT   = 15
+# Extra row dictionary read for compressed glyph groups
+CYCLES_UNPACK_DICT    = 5
+# AVR has no barrel shifter; variable shifts loop one bit at a time
+CYCLES_PER_SHIFT      = 3
+# Fast paths for build profiles with spare flash (see CONFIG.py):
+# load_unicode: one iteration of binary_search_range over unicode blocks
+CYCLES_BLOCK_ITER     = 35
+# load_unicode: block_pages read plus a short forward scan over blocks
+CYCLES_PAGE_LOOKUP    = 30
+# load_unicode: memcpy_P of one glyph from ascii_bitmaps
+CYCLES_ASCII_COPY     = 50
+# blit_rowwise: loop overhead and variable shifts removed by full unrolling
+CYCLES_UNROLLED_SAVED = 300
+# ... at the cost of this much extra code
+FLASH_UNROLLED_BLIT   = 900
+
+def search_iterations(n):
+  '''
+  Number of iterations a binary search over n items will take
+  '''
+  return int(ceil(log2(n+1))) if n>0 else 0
+
+################################################################################
+def load_codepoint_profile(filename):
+  '''
+  Count how often each codepoint appears in recorded terminal traffic. 
+  ANSI/ECMA-48 escape sequences and control characters are skipped, since
+  these are never looked up in the mapping tables. 
+  
+  Parameters
+  ----------
+  filename: utf-8 encoded capture of terminal output, or None
+  
+  Returns
+  -------
+  profile: dictionary, character -> number of occurences (empty if None)
+  '''
+  profile = {}
+  if filename is None: return profile
+  with open(filename,'rb') as f:
+    text = f.read().decode('utf8',errors='ignore')
+  # CSI sequences, then OSC strings, then two-byte escapes
+  text = re.sub(r'\x1b\[[\x30-\x3f]*[\x20-\x2f]*[\x40-\x7e]','',text)
+  text = re.sub(r'\x1b\][^\x07\x1b]*(\x07|\x1b\\)?','',text)
+  text = re.sub(r'\x1b.','',text)
+  for c in text:
+    if ord(c)<0x20 or 0x7f<=ord(c)<0xa0: continue
+    profile[c] = profile.get(c,0)+1
+  return profile
+
+################################################################################
+def block_layout_cost(first_offset, last_offset, weights, sparse):
+  '''
+  Flash and lookup-time cost of storing one mapped unicode block as either a
+  DENSE or a SPARSE table. 
+  
+  Parameters
+  ----------
+  first_offset: first mapped codepoint, relative to start of block
+  last_offset: last mapped codepoint, relative to start of block
+  weights: list of relative frequencies for each mapped codepoint in block
+  sparse: whether to price the SPARSE (True) or DENSE (False) encoding
+  
+  Returns
+  -------
+  nbytes: flash used by the codepoint_map and sparse-index entries
+  cycles: lookup cycles, summed over codepoints weighted by `weights`
+  '''
+  nmapped = len(weights)
+  # bstart_indecies (2), first_offsets (1), last_offsets (1)
+  nbytes  = 4
+  cycles  = CYCLES_TABLE_LOOKUP
+  if sparse: 
+    # codepoint_map (2) + sparse_indecies (1) per mapped codepoint, and
+    # sparse_offsets (2) + sparse_nmapped (1) per block
+    nbytes += 3*nmapped + 3
+    cycles += CYCLES_SPARSE_SETUP + \
+              CYCLES_SPARSE_ITER*search_iterations(nmapped)
+  else:
+    nbytes += 2*(last_offset-first_offset+1)
+  return nbytes, cycles*builtins.sum(weights)
+
+################################################################################
+def glyph_group_cost(nglyph, nrows, colstart, ncols, ndictionary=0):
+  '''
+  Flash used by one packed glyph group, and the cycles needed to unpack each
+  glyph within it (excluding the search for the group). 
+  
+  Parameters
+  ----------
+  nglyph: number of glyphs in group
+  nrows, colstart, ncols: geometry of the group's bitmaps. For compressed 
+      groups, ncols is the width of the packed row indecies.
+  ndictionary: number of entries in the group's row dictionary, or 0 if the
+      group stores raw pixel rows
+  
+  Returns
+  -------
+  nbytes: bytes of bitmap_data used by the group plus its 8 bytes of
+      group_* table entries
+  cycles: list of unpack cycles for each glyph in the group
+  '''
+  nbytes = nrows*int(ceil(nglyph*ncols/8)) + 8 + ndictionary
+  cycles = []
+  for k in range(nglyph):
+    bit_offset = (k*ncols)%8
+    is_split   = bit_offset+ncols>8
+    per_row    = CYCLES_UNPACK_ROW + CYCLES_PER_SHIFT*bit_offset
+    # Dictionary entries are stored pre-shifted by colstart
+    if ndictionary: per_row += CYCLES_UNPACK_DICT
+    else:           per_row += CYCLES_PER_SHIFT*colstart
+    if is_split:
+      per_row += CYCLES_UNPACK_SPLIT + CYCLES_PER_SHIFT*(8-bit_offset)
+    cycles.append(CYCLES_UNPACK_SETUP + nrows*per_row)
+  return nbytes, cycles
+
+################################################################################
+def compress_rows(glyph_rows, ncols):
+  '''
+  Re-encode a group of glyphs as indecies into a dictionary of the distinct
+  pixel rows that appear in the group. Rows are then unpacked by reading a
+  (hopefully narrower) index, and looking up the row in the dictionary. This
+  keeps every glyph the same size, so glyphs can still be found by indexing.
+  
+  Parameters
+  ----------
+  glyph_rows: list (one per glyph) of lists of packed pixel rows (integers,
+      with the leftmost pixel in the lowest-order bit)
+  ncols: width, in pixels, of the stored rows
+  
+  Returns
+  -------
+  dictionary: list of distinct row values, most common first
+  index_bits: number of bits needed to store an index into the dictionary
+  indecies: glyph_rows, with each row replaced by its dictionary index
+  '''
+  counts = {}
+  for rows in glyph_rows:
+    for r in rows: counts[r] = counts.get(r,0)+1
+  dictionary = sorted(counts,key=lambda r:(-counts[r],r))
+  lookup     = {r:i for i,r in enumerate(dictionary)}
+  index_bits = max(1,int(ceil(log2(len(dictionary))))) if dictionary else 1
+  indecies   = [[lookup[r] for r in rows] for rows in glyph_rows]
+  return dictionary, index_bits, indecies
+
+################################################################################
+def row_values(bits):
+  '''
+  Convert an array of binary pixels (leftmost first) to an integer
+  '''
+  return int(builtins.sum(int(b)<<i for i,b in enumerate(bits)))
+
+################################################################################
+def choose_layouts(options, budget):
+  '''
+  Pick one option per item to minimise total cycles within a flash budget.
+  
+  This is a greedy solution to the multiple-choice knapsack problem: start 
+  from the smallest option for each item, then repeatedly take the upgrade 
+  that saves the most cycles per extra byte, as long as it still fits in 
+  the budget. 
+  
+  Parameters
+  ----------
+  options: list (one entry per item) of lists of (nbytes, cycles) candidates
+  budget: total flash budget in bytes
+  
+  Returns
+  -------
+  choice: list of selected option indecies, one per item
+  '''
+  choice = [min(range(len(o)),key=lambda j:(o[j][0],o[j][1])) for o in options]
+  used   = builtins.sum(o[j][0] for o,j in zip(options,choice))
+  while True:
+    best, best_ratio = None, 0
+    for i,o in enumerate(options):
+      b0,c0 = o[choice[i]]
+      for j,(b,c) in enumerate(o):
+        saved, extra = c0-c, b-b0
+        if saved<=0 or used+extra>budget: continue
+        ratio = inf if extra<=0 else saved/extra
+        if ratio>best_ratio: best, best_ratio = (i,j,extra), ratio
+    if best is None: break
+    i,j,extra  = best
+    choice[i]  = j
+    used      += extra
+  return choice
+
+################################################################################
+# Python models of glyph transformation commands
+# These mirror the C helpers in fontmap.h; glyphs are tuples of CH packed rows,
+# bottom row first, leftmost pixel in the lowest-order bit (as in char_bitmap).
+def model_mirror_horizontal(rows, nudge):
+  out = []
+  for b in rows:
+    b = (b & 0b111111) >> nudge
+    b = ((0b000111&b)<<3)|((0b111000&b)>>3)
+    b = ((0b100100&b)>>2)|((0b001001&b)<<2)|(0b010010&b)
+    out.append(b)
+  return tuple(out)
+
+def model_mirror_vertical(rows, rstart, rstop):
+  rows = list(rows)
+  i = rstart
+  while i<=rstop:
+    rows[rstop-i],rows[i] = rows[i],rows[rstop-i]
+    i += 1
+  while i<len(rows):
+    rows[i] = 0
+    i += 1
+  return tuple(rows)
+
+def transform_models(commands):
+  '''
+  Build Python models for transformation commands whose C source only uses
+  reflections, or sets fixed pixels in fixed rows. Other commands (combining
+  diacritics, bold, italic, hooks...) are not modelled. 
+  
+  Parameters
+  ----------
+  commands: dictionary, abbreviation → (long name, C source code)
+  
+  Returns
+  -------
+  models: dictionary, abbreviation → function mapping glyph rows to glyph rows
+  '''
+  constants = {'CH':CH,'BASELINE':BASELINE,'MIDLINE':MIDLINE,'TOPLINE':TOPLINE}
+  reflections = {
+    'mirror_horizontal(1)'       :lambda r:model_mirror_horizontal(r,1),
+    'mirror_horizontal(0)'       :lambda r:model_mirror_horizontal(r,0),
+    'mirror_vertical()'          :lambda r:model_mirror_vertical(r,6,11),
+    'mirror_vertical_uppercase()':lambda r:model_mirror_vertical(r,6,10),
+    'mirror_vertical_lowercase()':lambda r:model_mirror_vertical(r,5, 8)}
+  assign  = re.compile(r'((?:char_bitmap\[[^\]]+\]\s*=\s*)+)(0b[01]+)')
+  overlay = re.compile(r'char_bitmap\[([^\]]+)\]\s*\|=\s*(0b[01]+)')
+  index   = re.compile(r'char_bitmap\[([^\]]+)\]')
+  # Row indecies are C integer expressions
+  row     = lambda q: eval(q.replace('/','//'),{},constants)
+  models  = {}
+  for abbreviation,description in commands.items():
+    if not isinstance(description,tuple): continue
+    steps = []
+    for statement in description[1].replace('\n','').split(';'):
+      statement = statement.strip()
+      if not statement: continue
+      if statement in reflections: 
+        steps.append(reflections[statement])
+        continue
+      m = overlay.fullmatch(statement)
+      if m:
+        i,v = row(m.group(1)), int(m.group(2),2)
+        steps.append(lambda r,i=i,v=v: r[:i]+(r[i]|v,)+r[i+1:])
+        continue
+      m = assign.fullmatch(statement)
+      if m:
+        ii = [row(q) for q in index.findall(m.group(1))]
+        v  = int(m.group(2),2)
+        steps.append(lambda r,ii=ii,v=v: 
+          tuple(v if j in ii else x for j,x in enumerate(r)))
+        continue
+      steps = None
+      break
+    if steps:
+      def model(rows,steps=steps):
+        for f in steps: rows = f(rows)
+        return rows
+      models[abbreviation] = model
+  return models
+
+################################################################################
+def read_c_array(filename, name):
+  '''
+  Read the values of a `static const ... name[] PROGMEM = {...};` array
+  from a generated header file.
+  '''
+  with open(filename,'r') as f: source = f.read()
+  m = re.search(r'\b%s\s*\[[^\]]*\]\s*PROGMEM\s*=\s*\{(.*?)\};'%name,source,re.S)
+  if m is None: raise ValueError('Array %s not found in %s'%(name,filename))
+  return [int(v,0) for v in re.findall(r'-?(?:0x[0-9A-Fa-f]+|\d+)',m.group(1))]
+
+def read_c_defines(filename):
+  '''
+  Read integer-valued `#define NAME (value)` constants from a header file.
+  '''
+  defines = {}
+  with open(filename,'r') as f:
+    for name,value in re.findall(
+      r'^#define\s+(\w+)\s+\(?\s*(-?(?:0x[0-9A-Fa-f]+|\d+))\s*\)?\s*(?://.*)?$',
+      f.read(),re.M):
+      defines[name] = int(value,0)
+  return defines
+
+################################################################################
+class CharBitmapOutOfRange(Exception): pass
+
+def model_combine_diacritic(rows, diacritic_index, bitmaps, info, locations):
+  '''
+  Python model of combine_diacritic() and stamp_diacritic() in
+  combining_diacritics.h, including the shorten/nudge/smash helpers from
+  textgraphics.h. 
+  
+  Parameters
+  ----------
+  rows: glyph rows, bottom first, leftmost pixel in lowest-order bit
+  diacritic_index: offset of the mark from 0x300, as in combine_diacritic()
+  bitmaps, info: contents of `diacritic_bitmaps` and `diacritic_info`
+  locations: dictionary of location codes (ABOVE, BELOW, ...)
+  
+  Returns
+  -------
+  rows: the transformed glyph rows, or None if the C code would read outside
+      of char_bitmap for this glyph (its result is then not well defined).
+  '''
+  L = locations
+  if 2*diacritic_index+1>=len(info): return tuple(rows)
+  index = info[2*diacritic_index]
+  if index==0xFF: return tuple(rows)
+  code     = info[2*diacritic_index+1]
+  location = code & 0b1111
+  pad      = (code>>4) & 0b11
+  nrow     = ((code>>6) & 0b11) + 1
+  rowdata  = [bitmaps[index+i] for i in range(nrow)]
+  cb       = [r & 0b111111 for r in rows]
+  
+  def get(i):
+    if not 0<=i<CH: raise CharBitmapOutOfRange()
+    return cb[i]
+  def copy_down(i):
+    for j in range(i,CH-1): cb[j] = cb[j+1]
+    cb[CH-1] = 0
+  def shorten_down_top():
+    i = CH-1
+    while not get(i) and i>=BASELINE: i-=1
+    if i==BASELINE: return False
+    while True:
+      if get(i)==get(i-1): break
+      i -= 1
+      if i<BASELINE: break
+    if i<=BASELINE: return False
+    copy_down(i)
+    return True
+  def nudge_down_top():
+    if cb[0]: return False
+    copy_down(0)
+    return True
+  def smash_down_top(conservative):
+    for i in range(CH-2,BASELINE,-1):
+      if not cb[i] and not (conservative and cb[i+1]&cb[i-1]):
+        copy_down(i)
+        return True
+    return False
+  def shift_up_to(i):
+    while i>=1: 
+      cb[i] = cb[i-1]
+      i -= 1
+    cb[0] = 0
+  def shorten_up_base():
+    i = 0
+    while not get(i) and i<CH: i+=1
+    while i<CH-1 and cb[i]!=cb[i+1]: i+=1
+    if i>=CH-1: return False
+    shift_up_to(i)
+    return True
+  def nudge_up_base():
+    if cb[CH-1]: return False
+    shift_up_to(CH-1)
+    return True
+  def smash_up_base(conservative):
+    for i in range(1,MIDLINE+1):
+      if not cb[i] and not (conservative and cb[i-1]&cb[i+1]):
+        shift_up_to(i)
+        return True
+    return False
+  
+  try:
+    if location==L['JAPANESE']: location = L['ABOVE']
+    if location==L['GREEK']:
+      i = CH-1
+      while cb[i]==0 and i>0: i-=1
+      location = L['ABOVE_LEFT'] if i>MIDLINE else L['ABOVE']
+    if location in (L['ABOVE_RIGHT'],L['BELOW_RIGHT']):
+      mask = 0
+      for r in rowdata: mask |= r
+      mask = (mask<<(8-CW)) & 0xFF
+      counter = 0
+      while 0<mask<128:
+        mask = (mask<<1) & 0xFF
+        counter += 1
+      rowdata  = [(r<<counter) & 0xFF for r in rowdata]
+      location = L['ABOVE'] if location==L['ABOVE_RIGHT'] else L['BELOW']
+    elif location in (L['ABOVE_LEFT'],L['BELOW_LEFT']):
+      mask = 0
+      for r in rowdata: mask |= r
+      counter = 0
+      while mask: 
+        mask >>= 1
+        counter += 1
+      rowdata  = [r>>counter for r in rowdata]
+      # (sic) matches the C code, which tests ABOVE_RIGHT here
+      location = L['BELOW']
+    if location==L['ABOVE']:
+      i = CH-1
+      while i>=MIDLINE and not get(i): i-=1
+      if get(i)==0b00001000 and get(i-1)==0:
+        cb[i] = 0
+        while i>=MIDLINE and not get(i): i-=1
+      start    = (i+pad) & 0xFF
+      last_row = (nrow-1)+start
+      if last_row>=CH:
+        need = last_row-(CH-1)
+        for step in (shorten_down_top, nudge_down_top,
+                     lambda:smash_down_top(True), lambda:smash_down_top(False)):
+          while need>0 and step():
+            need -= 1
+            start = (start-1) & 0xFF
+        while need>0 and pad>0:
+          pad   -= 1
+          need  -= 1
+          start  = (start-1) & 0xFF
+      elif i==MIDLINE-1:
+        if not any(cb[:MIDLINE]): start = (CH-1-nrow) & 0xFF
+      for k in range(nrow):
+        if k+start>=CH: break
+        cb[k+start] |= rowdata[k]
+    elif location==L['BELOW']:
+      i = 0
+      while i<CH and not cb[i]: i+=1
+      if i<nrow+pad-1:
+        need = nrow+pad-1-i-2
+        for step in (shorten_up_base, nudge_up_base,
+                     lambda:smash_up_base(True), lambda:smash_up_base(False)):
+          while need>0 and step(): need -= 1
+      for k in range(min(nrow,CH)): cb[k] |= rowdata[k]
+    elif location==L['OVERLAY']:
+      for k in range(nrow): cb[MIDLINE+k-nrow//2] |= rowdata[k]
+  except CharBitmapOutOfRange:
+    return None
+  return tuple(cb)
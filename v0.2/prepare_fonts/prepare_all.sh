@@ -2,6 +2,23 @@
 # sudo apt-get install xcftools to get xcf2png
 
 # Run all font preparation scripts
+# 
+# Select a build profile (see build_profiles in CONFIG.py) with TTY_PROFILE:
+#   TTY_PROFILE=latin ./prepare_all.sh
+# TTY_PROFILE=all generates the unicode mapping for every profile first, to
+# collect their flash and cycle estimates in build_profiles.txt, and then 
+# leaves the sketch set up for the full profile.
+TTY_PROFILE=${TTY_PROFILE:-full}
+if [ "$TTY_PROFILE" == "all" ]; then
+  for profile in $(TTY_PROFILE=full /usr/bin/env python3 -c \
+    "from CONFIG import build_profiles; print(' '.join(build_profiles))"); do
+    echo "Preparing mapping information for unicode (profile $profile)..."
+    TTY_PROFILE=$profile MPLBACKEND=Agg /usr/bin/env python3 \
+      prepare_unicode_mapping.py > /dev/null
+  done
+  TTY_PROFILE=full
+fi
+export TTY_PROFILE
 
 #echo "Converting xcf to png files..."
 #cd ./bitmaps
@@ -14,12 +31,15 @@ echo "Preparing basic terminal information..."
 echo "Preparing packed data for the main font glyphs and box drawing..."
 /usr/bin/env python3 prepare_main_font_bitmaps.py
 
-echo "Preparing mapping information for unicode..."
-/usr/bin/env python3 prepare_unicode_mapping.py
-
+# Combining diacritics come first: the unicode mapping reads their bitmaps
+# to bake frequent accented glyphs
 echo "Preparing combining diacritics code..."
 /usr/bin/env python3 prepare_combining_diacritics.py
 
+echo "Preparing mapping information for unicode..."
+/usr/bin/env python3 prepare_unicode_mapping.py
+
+cat build_profiles.txt
 echo "(DONE)"
 
 
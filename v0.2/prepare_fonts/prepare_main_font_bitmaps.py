@@ -38,6 +38,22 @@ C_SOURCE += '\n'
 
 C_SOURCE += pack_font(boxdrawing_image_filename,CW,CH)
 C_SOURCE += '\n'
+
+# Report what a row dictionary would save for the box-drawing glyphs. These are
+# kept as raw bitmaps: load_char_bitmaps_12x6 combines two glyphs by OR-ing 
+# their packed bytes, which row indecies don't support.
+img = imread(boxdrawing_image_filename)[:,:,:3]
+x   = np.all(img==1.0,axis=2)
+nr,nc = x.shape[0]//CH, x.shape[1]//CW
+glyphs = x.reshape(nr,CH,nc,CW).transpose(0,2,1,3).reshape(nr*nc,CH,CW)[:,::-1,:]
+dictionary,index_bits,_ = compress_rows(
+  [[row_values(r) for r in g] for g in glyphs],CW)
+raw_bytes = len(glyphs)*int(ceil(CW*CH/8))
+new_bytes = len(glyphs)*int(ceil(index_bits*CH/8)) + len(dictionary)
+print('Box drawing: %d distinct rows, %d-bit indecies: %d bytes raw, %d bytes'
+  ' with a row dictionary (%+d bytes, %+d cycles/glyph); kept raw'%(
+  len(dictionary),index_bits,raw_bytes,new_bytes,new_bytes-raw_bytes,
+  CH*CYCLES_UNPACK_DICT))
 C_SOURCE += "#endif /*%s_H*/\n"%headername
 
 with open(main_font_filename,'wb') as f:
@@ -153,6 +153,7 @@ mathematical_alphanumerics_base_glyphs =(
 
 import unicodedata
 import re
+import builtins
 from pylab          import *
 from CONFIG         import *
 from font_utilities import *
@@ -328,11 +329,154 @@ enclosed_alphanumerics_base_glyphs     = ''.join([aliasmap.get(c,c)[0]
 mathematical_alphanumerics_base_glyphs = ''.join([aliasmap.get(c,c)[0]
   for c in mathematical_alphanumerics_base_glyphs])
 
+# (Build profiles may leave out the soft-mapped blocks which need these)
+if not 'enclosedalphanumerics' in softmapped:
+  enclosed_alphanumerics_base_glyphs = ''
+if not 'mathematicalalphanumericsymbols' in softmapped:
+  mathematical_alphanumerics_base_glyphs = ''
+
 required = set(enclosed_alphanumerics_base_glyphs) | \
            set(mathematical_alphanumerics_base_glyphs)
 
 print(required)
 
+# ______________________________________________________________________________
+# Load character bitmaps from image file
+imagefn  = main_glyph_image_filename
+fontname = imagefn.split('/')[-1]
+fontname = fontname.split('.')[0].lower()
+img      = imread(imagefn)
+pixelstall, pixelswide, color_channels = img.shape
+if not (pixelstall%CH==0): raise ValueError('Image height %d not a multiple of %d pixels'%(pixelstall,CH))
+if not (pixelswide%CW==0): raise ValueError('Image width %d not a multiple of %d pixels'%(pixelswide,CW))
+# Ignore alpha or any extra channels if present
+if color_channels>3:
+    img = img[:,:,:3]
+NCOLS  = pixelswide // CW
+NROWS  = pixelstall // CH
+NCHARS = NCOLS*NROWS
+print('\nDetected %d columns' % NCOLS)
+print('Detected %d rows'    % NROWS)
+# Grab bit values by checking for white pixels
+x = np.all(img==1.0,axis=2)[:CH*NROWS,:CW*NCOLS]
+# Re-order into a list of HxW characters
+u = x.reshape(NROWS,CH,NCOLS,CW).transpose(0,2,1,3).reshape(NCHARS,CH,CW)
+u = u[:len(codepoints)]
+# We need to flip this upside down for the Arduino
+u = u[:,::-1,:]
+
+# ______________________________________________________________________________
+# Transform discovery: find base glyphs which some existing transform command
+# reproduces exactly from another base glyph. These are re-defined as
+# decompositions (base glyph + transform) so their bitmaps can be dropped.
+# - Only reflections and fixed-pixel overlays are modelled (font_utilities.py)
+# - ASCII glyphs are kept as base glyphs, to keep the common case fast
+# - Glyphs used as the base of other decompositions, or by the soft-mapped
+#   alphanumerics, are kept
+# - Transforms already in use are preferred, to avoid adding switch cases
+dropped_glyphs = set()
+if discover_transforms:
+  glyph_rows = {c:tuple(row_values(r) for r in u[i]) for i,c in enumerate(canoncode)}
+  models = transform_models(commands)
+  in_use = {v[1:] for v in decompose.values()}
+  order  = sorted(models,key=lambda t:(t not in in_use,t))
+  bases  = {aliasmap.get(v[0],v[0])[0] for v in decompose.values()}
+  keep   = set(ASCII) | set('� ') | required | bases
+  produced = {}
+  for b in canoncode:
+    if b=='�': continue
+    for t in order:
+      r = models[t](glyph_rows[b])
+      if r!=glyph_rows[b]: produced.setdefault(r,(b,t))
+  replaced = []
+  for c in canoncode:
+    if c in keep or not glyph_rows[c] in produced: continue
+    b,t = produced[glyph_rows[c]]
+    if b==c or b in dropped_glyphs: continue
+    # New bases must fit in the code page that supports transforms
+    if not b in bases and len(bases)>=MAXNCHAR-2: continue
+    decompose[c] = b+t
+    abbreviation_map.pop(c,None)
+    dropped_glyphs.add(c)
+    keep.add(b)
+    bases.add(b)
+    replaced.append((c,b,t))
+  print('\nPREPARE_UNICODE_MAPPING: Transform discovery replaced %d base glyphs:'
+    %len(replaced))
+  for c,b,t in replaced:
+    print('  %s = %s + %s%s (%s)'%(c,b,transform_code_prefix,t,commands[t][0]))
+  # Pairs of transforms can't be stored in one mapping entry, so only report
+  # these as candidates for new transform commands.
+  pairs = {}
+  for b in canoncode:
+    if b in dropped_glyphs or b=='�': continue
+    for t1 in order:
+      r1 = models[t1](glyph_rows[b])
+      for t2 in order:
+        r2 = models[t2](r1)
+        if r2!=glyph_rows[b]: pairs.setdefault(r2,(b,t1,t2))
+  pair_candidates = [(c,)+pairs[glyph_rows[c]] for c in canoncode 
+    if not c in keep and not c in dropped_glyphs and glyph_rows[c] in pairs]
+  print('PREPARE_UNICODE_MAPPING: These glyphs are a pair of transforms of another'
+    ' glyph\n(a combined transform command would let them be dropped):')
+  for c,b,t1,t2 in pair_candidates:
+    if b!=c: print('  %s = %s + %s + %s'%(c,b,t1,t2))
+
+# ______________________________________________________________________________
+# Profile-guided baking: the most frequent transformed glyphs (base glyph +
+# combining diacritic or modelled transform) are rendered here and stored as
+# base glyphs of their own. These then draw from a bitmap without running the
+# transform. Costs ~CH*CW/8 bytes of flash per glyph; nothing is baked without 
+# a codepoint profile.
+profile = load_codepoint_profile(codepoint_profile_filename)
+def profile_weight(c):
+  # Add one to every count, so that codepoints missing from a (finite) profile
+  # still carry some weight. Without a profile all codepoints weigh the same.
+  return profile.get(c,0)+1
+baked_glyphs = []
+if len(profile) and bake_flash_budget:
+  defines = read_c_defines(diacritics_filename)
+  diacritic_bitmaps = read_c_array(diacritics_filename,'diacritic_bitmaps')
+  diacritic_info    = read_c_array(diacritics_filename,'diacritic_info')
+  glyph_rows = {c:tuple(row_values(r) for r in u[i]) for i,c in enumerate(canoncode)}
+  models = transform_models(commands)
+  for t,(longname,sourcecode) in commands.items():
+    m = re.fullmatch(r'\s*combine_diacritic\((\w+)\);\s*',sourcecode)
+    if m and m.group(1) in defines:
+      models[t] = (lambda index: lambda rows: model_combine_diacritic(
+        rows,index,diacritic_bitmaps,diacritic_info,defines))(defines[m.group(1)])
+  counts = defaultdict(int)
+  for ch0,n in profile.items(): counts[aliasmap.get(ch0,ch0)[0]] += n
+  hot = sorted([c for c in decompose if counts[c]>0],key=lambda c:-counts[c])
+  bake_bytes = 0
+  skipped    = []
+  for c in hot:
+    b,t = aliasmap.get(decompose[c][0],decompose[c][0])[0], decompose[c][1:]
+    if b=='◌' or not b in glyph_rows or not t in models: continue
+    rows = models[t](glyph_rows[b])
+    # Skip glyphs which the C code can't render within the character cell
+    if rows is None or builtins.any(r>>CW for r in rows):
+      skipped.append(c)
+      continue
+    nbytes = (CH*CW+7)//8
+    if bake_bytes+nbytes>bake_flash_budget: break
+    bake_bytes += nbytes
+    u = concatenate([u,[[[(r>>x)&1 for x in range(CW)] for r in rows]]]).astype(bool)
+    canoncode += c
+    glyph_rows[c] = rows
+    del decompose[c]
+    shortname, name = generate_codepoint_name_abbreviation(c,aliases,abbreviation_map)
+    codepoint_names[c] = (shortname, name)
+    inverse_abbreviation_map[shortname] = c
+    baked_glyphs.append((c,b,t,counts[c]))
+  print('\nPREPARE_UNICODE_MAPPING: Baked %d hot transformed glyphs (%d bytes):'
+    %(len(baked_glyphs),bake_bytes))
+  for c,b,t,n in baked_glyphs:
+    print('  %s = %s + %s%s (%s), seen %d times'%(c,b,transform_code_prefix,t,
+      commands[t][0],n))
+  if len(skipped):
+    print('  Not baked (rendering exceeds the character cell):',''.join(skipped))
+
 base_glyphs_used    = set(required)
 transforms_required = set()
 missing_bases       = set()
@@ -341,7 +485,7 @@ for ch0 in mapped:
     # Convert to canonical alias if one exists
     ch = aliasmap.get(ch0,ch0)[0]
     # Is it supported as a base glyph?
-    if ch in canoncode: base_glyphs_used.add(ch)
+    if ch in canoncode and not ch in dropped_glyphs: base_glyphs_used.add(ch)
     # Is it supported as a transformed glyph
     elif ch in decompose:
         d = decompose[ch]
@@ -370,7 +514,7 @@ print('PREPARE_UNICODE_MAPPING: These points are mapped but not defined:')
 print(' '.join(sorted(list(undefined_chars))))
 print('')
 print('PREPARE_UNICODE_MAPPING: These glyphs are defined but never used:')
-unused_glyphs = set(canoncode) - base_glyphs_used
+unused_glyphs = set(canoncode) - base_glyphs_used - dropped_glyphs
 print(' '.join(sorted(list(unused_glyphs),key=lambda i:ord(i))))
 print('')
 print('PREPARE_UNICODE_MAPPING: These transforms are required but never defined:')
@@ -700,6 +844,8 @@ SOURCE+=('''\
 # blocks toward the beginning, so we'll need to defer adding things to 
 # the source code until blocks are processed and we know which ones should be
 # sparse vs dense. 
+candidates    = []
+glyph_weights = defaultdict(float)
 blocks        = []
 mapped_glyphs = set()
 dense_voids   = {}
@@ -760,17 +906,219 @@ for codename,(name,start,stop,nassigned) in blockinfo.items():
       blocksource   += '// (none mapped.)'
       missingblocks += [codename]
       continue
-    else: 
+    else:
       blocksource+='// Offsets in %d-%d are mapped.'%(first_offset,last_offset)
     #___________________________________________________________________________
-    # Check how sparse the block is. For <=256 characters a sparse list costs 1 
-    # byte per item, so stored items cost 1+2 bytes. So cost is N*3. For >256 
-    # the cost is n*4.
-    supported_range = last_offset - first_offset + 1
+    # Weight each mapped codepoint (and the glyph it uses) by how often it
+    # occurs in the recorded traffic, for the layout optimizer below.
+    weights = []
+    for i,b in enumerate(base_names):
+      if b=="0": continue
+      w = profile_weight(chr(start+i))
+      weights += [w]
+      glyph_weights[inverse_abbreviation_map[b]] += w
+    candidates.append((codename,name,start,stop,first_offset,last_offset,
+      total_supported,combined,base_names,blocksource,weights))
+
+#_______________________________________________________________________________
+# Figure out how much space needed to store each character  (there will be blank
+# space on the sides we can remove). Then, find glyphs matching other footprint
+# sizes. Maybe we can group glyphs according to their shapes?
+paddings = [*map(get_character_edge_padding,u)]
+ca = array(list(canoncode))
+def stridxs(s): return ''.join(sorted([ca[i] for i in s]))
+unmatched = {*enumerate(paddings)}
+padding_groups = []
+
+for q in '⁵₃×agAQfj½':
+  q  = aliasmap.get(q,q)[0]
+  i0 = canoncode.index(q)
+  p0 = paddings[i0]
+  L0,R0,B0,T0 = p0
+  matched = {(i,(L,R,B,T)) for i,(L,R,B,T) in unmatched if (L>0 and B>=B0 and T>=T0)}
+  if len(matched)<=0: continue
+  padding_groups+=[(p0,sorted([i for (i,p) in matched]))]
+  unmatched -= matched
+
+for q in 'ェぅԱբխॾラ':
+  q  = aliasmap.get(q,q)[0]
+  i0 = canoncode.index(q)
+  p0 = paddings[i0]
+  L0,R0,B0,T0 = p0
+  matched = {(i,(L,R,B,T)) for i,(L,R,B,T) in unmatched if (B>=B0 and T>=T0)}
+  if len(matched)<=0: continue
+  padding_groups+=[(p0,sorted([i for (i,p) in matched]))]
+  unmatched -= matched
+unmatched = [i for (i,p) in unmatched]
+
+for i,(k,v) in enumerate(padding_groups):
+  print(i)
+  print(k)
+  print(''.join([canoncode[i] for i in v]))
+
+# Check something
+"""
+padding_defined = ''.join([canoncode[i] 
+  for _,pg in padding_groups for i in pg])
+missing = set(canoncode)-set(padding_defined)
+if len(missing):
+  raise ValueError('! Somehow the following glyphs didn\'t get'
+  ' added to padding groups: %s'%''.join(sorted(list(missing))))
+sys.exit(0)
+"""
+
+#_______________________________________________________________________________
+# All groups divided into glyphs used for transforms and those not
+# - "replacement character" broken out as a special case.
+# - "space" broken out as a special case.
+# - "combining mark" broken out as a special case
+# Glyphs used with transforms must be packed first, so that they fit in the
+# first code page. These candidate groups may be merged by the optimizer.
+# Only glyphs reachable from the mapped and soft-mapped blocks are packed 
+# (base_glyphs_used includes the bases of decompositions), so build profiles
+# leave out glyphs that none of their blocks need.
+idx_used = {i for (i,c) in enumerate(canoncode) if c in glyphs_isused}
+remove   = {canoncode.index(c) for c in '� '} | \
+           {i for i,c in enumerate(canoncode) if not c in base_glyphs_used}
+paddings = array(paddings)
+group_candidates  = [(0,{canoncode.index('�')}), (0,{canoncode.index(' ')})]
+group_candidates += [(1,(set(fit)-remove)&idx_used) for p,fit in padding_groups]
+group_candidates += [(1,(set(unmatched)-remove)&idx_used)]
+group_candidates += [(2,(set(fit)-remove)-idx_used) for p,fit in padding_groups]
+group_candidates += [(2,(set(unmatched)-remove)-idx_used)]
+group_candidates  = [(phase,s) for phase,s in group_candidates if len(s)]
+
+def group_geometry(s):
+  '''
+  Bounding box (rowstart,nrows,colstart,ncols) for a set of glyph indecies
+  '''
+  ii = int32(sorted(s))
+  L,R,B,T = np.min(paddings[ii],axis=0)
+  nrows   = CH-B-T
+  ncols   = CW-R-L
+  # Patch for now in case we encounter an empty space
+  if nrows<0: return 0,0,0,0
+  return T,nrows,L,ncols
+
+def group_costs(groups):
+  '''
+  Flash bytes and weighted glyph-loading cycles for a list of glyph groups
+  '''
+  nbytes = cycles = 0
+  search = CYCLES_GROUP_ITER*search_iterations(len(groups))
+  for phase,s in groups:
+    rowstart,nrows,colstart,ncols = group_geometry(s)
+    b,c = glyph_group_cost(len(s),nrows,colstart,ncols)
+    w   = [glyph_weights[canoncode[i]] for i in sorted(s,key=lambda i:ca[i])]
+    nbytes += b
+    cycles += builtins.sum(wi*(ci+search) for wi,ci in zip(w,c))
+  return nbytes, cycles
+
+#_______________________________________________________________________________
+# Layout optimizer
+# Each mapped block can be stored DENSE (fast, 2 bytes per codepoint in the
+# mapped range) or SPARSE (3 bytes per mapped codepoint, plus a binary search).
+# Neighbouring glyph groups can also be merged: this costs bitmap space (the
+# merged bounding box is larger) and unpacking time (more rows), but shortens
+# the binary search over groups. We price each choice with the cost model in
+# font_utilities.py, weighted by the codepoint profile, and keep whichever
+# layout has the lowest expected lookup time within the flash budget.
+block_options = []
+fixed_rule    = []
+for codename,name,start,stop,first_offset,last_offset,total_supported,\
+    combined,base_names,blocksource,weights in candidates:
+  supported_range = last_offset - first_offset + 1
+  # The old fixed rule: go sparse if this saves a third of the space.
+  fixed_rule += [int(supported_range<=256 and 3*total_supported<2*supported_range)]
+  dense_cost  = block_layout_cost(first_offset,last_offset,weights,False)
+  sparse_cost = block_layout_cost(first_offset,last_offset,weights,True)
+  # Sparse index lists store offsets in single bytes
+  block_options += [[dense_cost, sparse_cost] if supported_range<=256 else [dense_cost]]
+fixed_block_bytes = builtins.sum(o[j][0] for o,j in zip(block_options,fixed_rule))
+fixed_group_bytes, fixed_group_cycles = group_costs(group_candidates)
+fixed_block_cycles = builtins.sum(o[j][1] for o,j in zip(block_options,fixed_rule))
+budget = layout_flash_budget
+if budget is None: budget = fixed_block_bytes + fixed_group_bytes
+
+# Build profiles with a `font_flash_budget` spend the flash that their blocks 
+# don't need on fast paths, most cycles saved per byte first, and then on the
+# mapping tables (see CONFIG.py). 
+# The ASCII table holds finished bitmaps, so characters that are decomposed
+# (e.g. '>' is '<' reflected) are rendered through their transform here.
+ascii_models = transform_models(commands)
+ascii_rows   = []
+for i in range(0x20,0x7F):
+  c = aliasmap.get(chr(i),chr(i))[0]
+  if c in canoncode and not c in dropped_glyphs:
+    rows = tuple(row_values(r) for r in u[canoncode.index(c)])
+  elif c in decompose:
+    b,t = aliasmap.get(decompose[c][0],decompose[c][0])[0], decompose[c][1:]
+    if not b in canoncode or not t in ascii_models: break
+    rows = ascii_models[t](tuple(row_values(r) for r in u[canoncode.index(b)]))
+    if rows is None or builtins.any(r>>CW for r in rows): break
+  else: break
+  ascii_rows += [list(rows)]
+profile_rows = sorted({(start//16,(stop+1)//16) for codename,(_,start,stop,_) in 
+  get_unicode_blocks_information().items() if codename in mapped_blocks+softmapped})
+block_search = CYCLES_BLOCK_ITER*search_iterations(len(profile_rows))
+total_weight = max(1,builtins.sum(glyph_weights.values()))
+ascii_weight = builtins.sum(profile_weight(chr(i)) for i in range(0x20,0x7F))
+fast_path_options = [
+  ('ASCII_TABLE',  (0x7F-0x20)*CH, ascii_weight*(block_search 
+    + CYCLES_TABLE_LOOKUP + CYCLES_GROUP_ITER*search_iterations(len(group_candidates))
+    + CYCLES_UNPACK_SETUP + CH*CYCLES_UNPACK_ROW - CYCLES_ASCII_COPY)),
+  ('PAGE_TABLE',   (profile_rows[-1][1]-1)//16+1, 
+    total_weight*(block_search-CYCLES_PAGE_LOOKUP)),
+  ('UNROLLED_BLIT', FLASH_UNROLLED_BLIT, total_weight*CYCLES_UNROLLED_SAVED)]
+fast_paths = []
+fast_path_bytes = fast_path_saved = 0
+if font_flash_budget is not None:
+  spare = font_flash_budget - budget
+  for name,nbytes,saved in sorted(fast_path_options,key=lambda o:-o[2]/o[1]):
+    # Every printable ASCII character needs a bitmap
+    if name=='ASCII_TABLE' and len(ascii_rows)<0x7F-0x20: continue
+    if saved<=0 or nbytes>spare: continue
+    fast_paths      += [name]
+    fast_path_bytes += nbytes
+    # The unrolled blit saves drawing time, which the lookup estimate omits
+    if name!='UNROLLED_BLIT': fast_path_saved += saved
+    spare           -= nbytes
+  budget += max(0,spare)
+
+# Glyph groups first: try merging neighbours within the same packing phase,
+# keeping only merges that lower the expected cycles.
+groups = list(group_candidates)
+merges = []
+while True:
+  gbytes, gcycles = group_costs(groups)
+  best = None
+  for k in range(2,len(groups)-1):
+    if groups[k][0]!=groups[k+1][0]: continue
+    trial = groups[:k]+[(groups[k][0],groups[k][1]|groups[k+1][1])]+groups[k+2:]
+    b,c = group_costs(trial)
+    if c<gcycles and (best is None or c<best[2]): best = (k,b,c,trial)
+  if best is None: break
+  k,b,c,trial = best
+  # Merged groups must leave room for the smallest block tables
+  if b + builtins.sum(min(o)[0] for o in block_options) > budget: break
+  merges += [(stridxs(groups[k][1]),stridxs(groups[k+1][1]),gcycles-c,b-gbytes)]
+  groups  = trial
+group_bytes, group_cycles = group_costs(groups)
+
+# Then spend the remaining budget on block encodings
+block_choice = choose_layouts(block_options, budget-group_bytes)
+block_bytes  = builtins.sum(o[j][0] for o,j in zip(block_options,block_choice))
+block_cycles = builtins.sum(o[j][1] for o,j in zip(block_options,block_choice))
+
+#_______________________________________________________________________________
+# Emit the chosen block layouts
+for (codename,name,start,stop,first_offset,last_offset,total_supported,
+    combined,base_names,blocksource,weights),sparse in \
+    zip(candidates,block_choice):
     mapdata = '  '
     j = 0;
-    sparse = supported_range<=256 and 3*total_supported<2*supported_range
-    if sparse: 
+    sparse = bool(sparse)
+    if sparse:
       blocksource += '\n// This is a sparse block.'
       issparse    += [codename]
     included = []
@@ -890,143 +1238,86 @@ print('\nThese base glyphs are used, but not in in transfomed characters:')
 print(''.join(sorted(list(mapped_glyphs - glyphs_isused))))
 
 ################################################################################
-# Clever code to change how glyph data is packed goes here? 
-
-#_______________________________________________________________________________
-# Load character bitmaps from image file
-imagefn  = main_glyph_image_filename
-fontname = imagefn.split('/')[-1]
-fontname = fontname.split('.')[0].lower()
-img      = imread(imagefn)
-pixelstall, pixelswide, color_channels = img.shape
-if not (pixelstall%CH==0): raise ValueError('Image height %d not a multiple of %d pixels'%(pixelstall,CH))
-if not (pixelswide%CW==0): raise ValueError('Image width %d not a multiple of %d pixels'%(pixelswide,CW))
-# Ignore alpha or any extra channels if present
-if color_channels>3: 
-    img = img[:,:,:3]
-NCOLS  = pixelswide // CW
-NROWS  = pixelstall // CH
-NCHARS = NCOLS*NROWS
-print('\nDetected %d columns' % NCOLS)
-print('Detected %d rows'    % NROWS)
-# Grab bit values by checking for white pixels
-x = np.all(img==1.0,axis=2)[:CH*NROWS,:CW*NCOLS]
-# Re-order into a list of HxW characters
-u = x.reshape(NROWS,CH,NCOLS,CW).transpose(0,2,1,3).reshape(NCHARS,CH,CW)
-u = u[:len(codepoints)]
-# We need to flip this upside down for the Arduino
-u = u[:,::-1,:]
-
-#_______________________________________________________________________________
-# Figure out how much space needed to store each character  (there will be blank
-# space on the sides we can remove). Then, find glyphs matching other footprint
-# sizes. Maybe we can group glyphs according to their shapes? 
-paddings = [*map(get_character_edge_padding,u)]
-ca = array(list(canoncode))
-def stridxs(s): return ''.join(sorted([ca[i] for i in s]))
-unmatched = {*enumerate(paddings)}
-padding_groups = []
-
-for q in '⁵₃×agAQfj½':
-  q  = aliasmap.get(q,q)[0]
-  i0 = canoncode.index(q)
-  p0 = paddings[i0]
-  L0,R0,B0,T0 = p0
-  matched = {(i,(L,R,B,T)) for i,(L,R,B,T) in unmatched if (L>0 and B>=B0 and T>=T0)}
-  if len(matched)<=0: continue
-  padding_groups+=[(p0,sorted([i for (i,p) in matched]))]
-  unmatched -= matched
-
-for q in 'ェぅԱբխॾラ':
-  q  = aliasmap.get(q,q)[0]
-  i0 = canoncode.index(q)
-  p0 = paddings[i0]
-  L0,R0,B0,T0 = p0
-  matched = {(i,(L,R,B,T)) for i,(L,R,B,T) in unmatched if (B>=B0 and T>=T0)}
-  if len(matched)<=0: continue
-  padding_groups+=[(p0,sorted([i for (i,p) in matched]))]
-  unmatched -= matched
-unmatched = [i for (i,p) in unmatched]
-
-for i,(k,v) in enumerate(padding_groups):
-  print(i)
-  print(k)
-  print(''.join([canoncode[i] for i in v]))
-
-# Check something
-"""
-padding_defined = ''.join([canoncode[i] 
-  for _,pg in padding_groups for i in pg])
-missing = set(canoncode)-set(padding_defined)
-if len(missing):
-  raise ValueError('! Somehow the following glyphs didn\'t get'
-  ' added to padding groups: %s'%''.join(sorted(list(missing))))
-sys.exit(0)
-"""
+# Report on the layout optimizer's choices
+print('\nLayout optimizer (flash budget %d bytes):'%budget)
+if codepoint_profile_filename is None:
+  print('  No codepoint profile given, all mapped codepoints weighted equally')
+else:
+  print('  Weighted by %d codepoints in %s'%(builtins.sum(profile.values()),
+    codepoint_profile_filename))
+for (codename,*_),fixed,chosen in zip(candidates,fixed_rule,block_choice):
+  if fixed!=chosen:
+    print('  %-36s %s (fixed rule would use %s)'%(codename,
+      ['DENSE','SPARSE'][chosen],['DENSE','SPARSE'][fixed]))
+for a,b,saved,extra in merges:
+  print('  Merged glyph groups %s + %s: %+d bytes, %.0f fewer cycles'%(
+    a,b,extra,saved))
+print('  Mapping tables: %5d bytes, %6.1f cycles/lookup (fixed rule: %d, %.1f)'%(
+  block_bytes,block_cycles/total_weight,
+  fixed_block_bytes,fixed_block_cycles/total_weight))
+print('  Glyph bitmaps:  %5d bytes, %6.1f cycles/glyph  (fixed rule: %d, %.1f)'%(
+  group_bytes,group_cycles/total_weight,
+  fixed_group_bytes,fixed_group_cycles/total_weight))
 
 #_______________________________________________________________________________
-# All groups divided into glyphs used for transforms and those not
-# - "replacement character" broken out as a special case. 
-# - "space" broken out as a special case. 
-# - "combining mark" broken out as a special case
+# Pack glyph groups in the order chosen by the layout optimizer.
 # Build a binary search tree. For each grouping we need to know
 # - start, end glyph index
-idx_used = {i for (i,c) in enumerate(canoncode) if c in glyphs_isused}
 print('Reminder: %d glyphs are used in transformations'%len(glyphs_isused))
 print('Reminder: %d transformations defined'%NUMBER_OF_TRANSFORMS)
-remove = {canoncode.index(c) for c in '� '}
 reordered = ''
 groupinfo = []
 blockdata = []
-paddings  = array(paddings)
+group_dictionaries = []
+compression_report = []
 def add_glyph_group(s):
-  global reordered, groupinfo, blockdata
+  global reordered, groupinfo, blockdata, group_dictionaries
   if not len(s): return
+  rowstart,nrows,colstart,ncols = group_geometry(s)
   s = stridxs(s)
   print('Group %d:'%len(groupinfo),s)
   # We need to figure out how to pack this group. Each group needs: start 
   # index, number of glyphs, row start, col start, nrows, ncols
   ii = int32([canoncode.index(c) for c in s])
-  L,R,B,T    = np.min(paddings[ii],axis=0)
-  rowstart   = T
-  colstart   = L
-  nrows      = CH-B-rowstart
-  ncols      = CW-R-colstart
-  # Patch for now in case we encounter an empty space
-  if nrows<0:
-    rowstart = colstart = 0
-    nrows = 0
-    ncols = 0
-    L = 0
-    T = 0
-    B = CH
-    R = CW
   nglyph     = len(ii)
   gstart     = len(reordered)
-  groupinfo += [(gstart,nglyph,rowstart,nrows,colstart,ncols)]
-  rowdata    = concatenate([u[i][T:CH-B,L:CW-R] for i in ii],axis=1)
+  rowdata    = concatenate([u[i][rowstart:rowstart+nrows,colstart:colstart+ncols]
+    for i in ii],axis=1)
   print(shape(rowdata))
+  # Try storing the group as a row dictionary plus row indecies; keep this
+  # only if it's smaller than the raw pixel rows.
+  dictionary = None
+  if compress_glyph_groups and nrows>0:
+    glyph_rows = [[row_values(rowdata[r,k*ncols:(k+1)*ncols]) 
+      for r in range(nrows)] for k in range(nglyph)]
+    dictionary,index_bits,indecies = compress_rows(glyph_rows,ncols)
+    raw_bytes,raw_cycles = glyph_group_cost(nglyph,nrows,colstart,ncols)
+    new_bytes,new_cycles = glyph_group_cost(nglyph,nrows,colstart,index_bits,
+      len(dictionary))
+    compression_report.append((len(groupinfo),nglyph,ncols,len(dictionary),
+      index_bits,raw_bytes,new_bytes,mean(raw_cycles),mean(new_cycles)))
+    if new_bytes<raw_bytes:
+      packed     = array([[(indecies[k][r]>>b)&1 
+        for k in range(nglyph) for b in range(index_bits)] 
+        for r in range(nrows)])
+      packed     = array([bitpack_row(d) for d in packed]).T
+      dictionary = ([v<<colstart for v in dictionary],index_bits,packed)
+    else: dictionary = None
+  group_dictionaries += [dictionary]
+  groupinfo += [(gstart,nglyph,rowstart,nrows,colstart,ncols)]
   rowdata    = array([bitpack_row(d) for d in rowdata]).T
   blockdata += [rowdata]
   reordered += s
 
 # Prepare bitmap groups; '�' ' ' handled as ad-hoc patches for now. 
-add_glyph_group({canoncode.index('�')})
-add_glyph_group({canoncode.index(' ')})
-
-for (L0,R0,B0,T0),fit in padding_groups: 
-  add_glyph_group((set(fit) - remove) & idx_used)
-add_glyph_group((set(unmatched) - remove) & idx_used)
+for phase,s in groups: add_glyph_group(s)
 
-# By now all used indecies should be mapped
-if len(reordered)>MAXNCHAR-2:
+# All glyphs used with transforms should be in the first code page
+nused = sum([len(s) for phase,s in groups if phase<2])
+if nused>MAXNCHAR-2:
   print('REORDERED:',reordered)
   raise ValueError(('No more than %d characters can be used as base glyphs,'
-  ' but there are %d base glyphs!')%(MAXNCHAR-2,len(reordered)))
-
-for (L0,R0,B0,T0),fit in padding_groups: 
-  add_glyph_group((set(fit) - remove) - idx_used)
-add_glyph_group((set(unmatched) - remove) - idx_used)
+  ' but there are %d base glyphs!')%(MAXNCHAR-2,nused))
 
 for i in idx_used:
   if not canoncode[i] in reordered:
@@ -1050,6 +1341,16 @@ SOURCE += '\n// `group_nglyphs` tells you the number of glyphs in each group. Th
 SOURCE += '\n// `group_rowstart`, `group_nrow`, `group_colstart`, `group_ncol` indicate'
 SOURCE += '\n// where within the 6x12 character the glyph bitmap should be drawn. (Most glyph'
 SOURCE += '\n// bitmaps do not store the full 6x12 image, there is a lot of empty space.)'
+# Compressed groups need a table of dictionary offsets for every group, so only
+# use them if they save more than this costs.
+reclaimed = sum([b0-b1 for g,n,w,nd,k,b0,b1,c0,c1 in compression_report 
+  if group_dictionaries[g] is not None]) - 2*len(groupinfo)
+if reclaimed<=0: group_dictionaries = [None]*len(groupinfo)
+for g,d in enumerate(group_dictionaries):
+  if d is None: continue
+  dictionary,index_bits,packed = d
+  blockdata[g] = packed
+  groupinfo[g] = groupinfo[g][:5]+(index_bits,)
 SOURCE += '\n#define NGLYPHS (%d)'%len(reordered)
 SOURCE += '\n#define NGROUPS (%d)'%len(groupinfo)
 start_index = 0
@@ -1065,7 +1366,8 @@ SOURCE += pack_array(start_idxs,'group_bitmap_offsets')
 # Add arrays that contain information for how to find glyphs in each group
 gstart,nglyph,growstart,ngrows,gcolstart,ngcols = array(groupinfo).T
 SOURCE += '\n// Starting glyph index for each group of glyph bitmaps'
-SOURCE += pack_array(gstart   ,'group_startidx')
+# Read with pgm_read_word, even when a small profile has few glyphs
+SOURCE += pack_array(gstart   ,'group_startidx','unsigned int')
 SOURCE += '\n// Number of glyphs in each group of glyph bitmaps'
 SOURCE += pack_array(nglyph   ,'group_nglyphs' )
 SOURCE += '\n// Starting row of glyph bitmap for each group'
@@ -1076,6 +1378,20 @@ SOURCE += '\n// Starting column of bitmap for each group'
 SOURCE += pack_array(gcolstart,'group_colstart')
 SOURCE += '\n// Nuber of columns in bitmap for each group'
 SOURCE += pack_array(ngcols   ,'group_ncol'    )
+if any([d is not None for d in group_dictionaries]):
+  row_dictionary   = []
+  dictionary_start = []
+  for d in group_dictionaries:
+    dictionary_start += [len(row_dictionary) if d is not None else 0xFFFF]
+    if d is not None: row_dictionary += d[0]
+  SOURCE += '\n// Some groups are compressed: for these, group_ncol is the width of an index'
+  SOURCE += '\n// into a dictionary of the distinct pixel rows in that group. Dictionary rows'
+  SOURCE += '\n// are stored already shifted by group_colstart.'
+  SOURCE += '\n#define COMPRESSED_GLYPH_GROUPS'
+  SOURCE += '\n#define NO_DICTIONARY (0xFFFF)'
+  SOURCE += pack_array(row_dictionary,'row_dictionary')
+  SOURCE += '\n// Start of each group\'s rows in row_dictionary, or NO_DICTIONARY'
+  SOURCE += pack_array(dictionary_start,'group_dictionary_offsets')
 # C routine to unpack this data
 SOURCE += '''
 /*
@@ -1159,7 +1475,11 @@ but also too confusing.
 inline void load_rowpacked_glyph(const byte *c, 
   unsigned int index, 
   byte rowstart, byte nrows,
-  byte colstart, byte ncols ) {
+  byte colstart, byte ncols
+#ifdef COMPRESSED_GLYPH_GROUPS
+  , const byte *dictionary
+#endif
+  ) {
   
   // Start by zeroing out empty rows
   
@@ -1204,8 +1524,16 @@ inline void load_rowpacked_glyph(const byte *c,
     // Get second byte if needed
     if (is_split) row_data |= ((byte)pgm_read_byte(read_head+nrows)) << (8-bit_offset);
     
+    row_data &= bitmask;
+    
+#ifdef COMPRESSED_GLYPH_GROUPS
+    // Compressed groups store an index into a dictionary of rows, which have
+    // already been shifted into place.
+    if (dictionary) char_bitmap[r] = pgm_read_byte(dictionary + row_data);
+    else
+#endif
     // Shift into place and store in the character bitmap register
-    char_bitmap[r] = (row_data&bitmask) << colstart;
+    char_bitmap[r] = row_data << colstart;
     
     r++;
     read_head++;
@@ -1221,9 +1549,17 @@ byte load_glyph_bitmap(unsigned int i) {
   int found = binary_search_range(i,NGROUPS,group_startidx,group_nglyphs);
   if (found<0) return NOT_IMPLEMENTED;
   unsigned int offset = pgm_read_word(group_bitmap_offsets + found);
+#ifdef COMPRESSED_GLYPH_GROUPS
+  unsigned int doffset = pgm_read_word(group_dictionary_offsets + found);
+  const byte *dictionary = doffset==NO_DICTIONARY? NULL : row_dictionary+doffset;
+#endif
   load_rowpacked_glyph(bitmap_data+offset, i - pgm_read_word(group_startidx +found),
     pgm_read_byte(group_rowstart +found), pgm_read_byte(group_nrow +found),
-    pgm_read_byte(group_colstart +found), pgm_read_byte(group_ncol +found));
+    pgm_read_byte(group_colstart +found), pgm_read_byte(group_ncol +found)
+#ifdef COMPRESSED_GLYPH_GROUPS
+    , dictionary
+#endif
+    );
   return LOADED;
 }
 
@@ -1353,6 +1689,15 @@ for shortname,(name,start,stop,nassigned) in blockinfo.items():
       assert 0
     blockcodes += [index*4 + code]
 SOURCE += pack_array(blockcodes,'blockcodes')
+if 'PAGE_TABLE' in fast_paths:
+  # Index of the first block that ends after the start of each 256-codepoint
+  # page; load_unicode scans forward from here.
+  pages = [int(sum(starts+lengths<=p*16)) for p in range(((starts+lengths)[-1]-1)//16+1)]
+  SOURCE += '\n// PAGE_TABLE fast path: first block for each 256-codepoint page'
+  SOURCE += pack_array(pages,'block_pages')
+if 'ASCII_TABLE' in fast_paths:
+  SOURCE += '\n// ASCII_TABLE fast path: bitmaps for printable ASCII, CH rows each'
+  SOURCE += pack_array(array(ascii_rows),'ascii_bitmaps')
 SOURCE += '\n// For DENSE and SPARSE blocks, the index code provides the offset into the'
 SOURCE += '\n// bstart_indecies, first_offsets, last_offsets, sparse_offsets, and '
 SOURCE += '\n// sparse_nmapped arrays. For SOFT blocks, the index is an offset into the '
@@ -1442,17 +1787,34 @@ int handle_unicode_mapping_table(byte blocktype, byte i, byte c) {
 /** Dispatch unicode point to subroutines for handling various blocks and 
  *  range of codepoints.
  */
-int load_unicode(uint32_t code) {
+int find_unicode(uint32_t code) {
 
   //Serial.print("Code ");
   //Serial.println(code);
 
+#ifdef PROFILE_ASCII_TABLE
+  // Printable ASCII is stored as raw bitmaps; skip all lookups
+  if (code>=0x20 && code<0x7F) {
+    memcpy_P(char_bitmap, ascii_bitmaps+(code-0x20)*CH, CH);
+    return LOADED;
+  }
+#endif
+
   // Divide code by 16 to get its "row" in the uncode table
   unsigned int coderow = code>>4;
   // Skip codepoints past the end of the mapped blocks
   if (coderow>=LASTROW+1) return NOT_IMPLEMENTED;
+#ifdef PROFILE_PAGE_TABLE
+  // Start at the first block ending after the start of this 256-codepoint 
+  // page, and scan forward; pages seldom hold more than a few blocks.
+  int found = pgm_read_byte(block_pages + (coderow>>4));
+  while (found<NBLOCKS && coderow>=pgm_read_word(&block_starts_x16[found])
+                                  +pgm_read_byte(&block_lengths_x16[found])) found++;
+  if (found>=NBLOCKS || coderow<pgm_read_word(&block_starts_x16[found])) found=-1;
+#else
   // Binary search to find function to handle this block
   int found = binary_search_range(coderow, NBLOCKS, block_starts_x16, block_lengths_x16);
+#endif
   
   //Serial.print("Block info index ");
   //Serial.println(found);
@@ -1485,33 +1847,25 @@ int load_unicode(uint32_t code) {
   return handle_unicode_mapping_table(blocktype, blockidx, code);
 }
 
+/** Load a unicode codepoint from the font tables or, failing that, from the
+ *  glyphs uploaded by the host (softglyphs.h).
+ */
+int load_unicode(uint32_t code) {
+  int result = find_unicode(code);
+#ifdef SOFT_GLYPHS
+  if (result==NOT_IMPLEMENTED) result = load_soft_glyph(code);
+#endif
+  return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
-/** Parse utf-8 encoded unicode codepoint. Based on the first byte, this will
- *  attempt to read up to 3 more bytes from the serial input. If a valid 
- *  unicode sequence is found, it will attempt to interpret and draw the 
- *  corresponding character. Returns FAIL if an invalid utf-8 sequence 
- *  encountered, or if there was an error in rendering the unicode point. If it
- *  cannot render the given unicode point, the replacement character <?> should
- *  be rendered instead. 
- *  @param byte1: first byte of a putative unicode sequence (we'll wait for 
- *      more if needed)
+/** Finish drawing a glyph at the cursor, after load_unicode or 
+ *  handle_transform, and advance the cursor. Loaded glyphs are styled and
+ *  drawn from char_bitmap; on an error, the replacement character <?> is 
+ *  drawn instead. 
+ *  @param return_code: what loading the glyph returned
  */
-int parse_utf8(byte byte1) {
-  uint32_t code = byte1;
-  if (byte1>=128) {
-    int nbytes = 0;
-    if      ((byte1>>5)==0b110  ) {code=byte1 & 0b11111; nbytes=1;}
-    else if ((byte1>>4)==0b1110 ) {code=byte1 &  0b1111; nbytes=2;}
-    else if ((byte1>>3)==0b11110) {code=byte1 &   0b111; nbytes=3;}
-    if (!nbytes) return FAIL; // Ignore bad utf-8
-    for (int j=0; j<nbytes; j++) {
-      byte b = blocking_read();
-      if (!((b>>6)==0b10)) return FAIL; // Ignore bad utf-8
-      code = (code<<6)|(b&0b111111);}
-  }
-  //pause_incoming_serial();
-  prepare_cursor();
-  byte return_code = load_unicode(code);
+int draw_loaded(byte return_code) {
   if (return_code == LOADED) {
     // Soft-fonts draw, but mapped fonts only load the character bitmap.
     // This allows the mathematical alphanumerics soft-font to re-use the
@@ -1519,7 +1873,7 @@ int parse_utf8(byte byte1) {
     // further style characters before drawing. 
     drawStyledChar();
     advance_cursor(1);   
-    return SUCCESS;
+    return LOADED;
   }
   else if (return_code != SUCCESS) {
     //load_and_draw_glyph(REPLACEMENT_CHARACTER);
@@ -1529,6 +1883,19 @@ int parse_utf8(byte byte1) {
   }
   return return_code;
 }
+
+/** Draw a unicode codepoint at the cursor, and advance the cursor. The utf-8
+ *  decoding is done by the input parser (parser.h). Returns FAIL if there was 
+ *  an error in rendering the unicode point. If it cannot render the given 
+ *  unicode point, the replacement character <?> should be rendered instead. 
+ *  Returns LOADED if the styled glyph is left in char_bitmap, so that it 
+ *  can be drawn again without reloading (see REP in control.h). 
+ *  @param code: unicode codepoint
+ */
+int draw_unicode(uint32_t code) {
+  prepare_cursor();
+  return draw_loaded(load_unicode(code));
+}
 '''
 
 ################################################################################
@@ -1574,6 +1941,60 @@ CODESOURCE += '\n\n#endif // %s\n'%codeheadername
 with open(unicode_mapping_filename,'wb') as f: f.write(SOURCE    .encode('utf8'))
 with open(glyphcodes_filename     ,'wb') as f: f.write(CODESOURCE.encode('utf8'))
 
+#_______________________________________________________________________________
+# Build profile flags are needed before fontmap.h is included (the blitter in
+# textgraphics.h uses them), so they go in a header of their own
+profilename    = build_profile_filename.split(os.sep)[-1].split('.')[0].upper()
+PROFILESOURCE  = '#ifndef %s_H\n#define %s_H\n'%(profilename,profilename)
+PROFILESOURCE += '// This file is automatically generated, do not edit it,\n'
+PROFILESOURCE += '// see ./prepare_fonts/README.md for more information. \n\n'
+PROFILESOURCE += '// Build profile (TTY_PROFILE, see build_profiles in CONFIG.py)\n'
+PROFILESOURCE += '#define BUILD_PROFILE "%s"\n'%build_profile
+PROFILESOURCE += '\n// Fast paths enabled with the flash this profile leaves over\n'
+for name in fast_paths: PROFILESOURCE += '#define PROFILE_%s\n'%name
+if not len(fast_paths): PROFILESOURCE += '// (none)\n'
+PROFILESOURCE += '\n#endif // %s_H\n'%profilename
+with open(build_profile_filename  ,'wb') as f: f.write(PROFILESOURCE.encode('utf8'))
+
+#_______________________________________________________________________________
+# Flash and cycle estimates for this profile; keep one line per profile in the
+# report so that profiles can be compared. 
+total_bytes = block_bytes + group_bytes + fast_path_bytes
+cycles      = (block_cycles + group_cycles + total_weight*block_search 
+               - fast_path_saved)/total_weight
+print('\nBuild profile %s: %d blocks, %d glyphs'%(
+  build_profile,len(profile_rows),len(reordered)))
+print('  Mapping tables %d + glyph bitmaps %d + fast paths %d = %d bytes'%(
+  block_bytes,group_bytes,fast_path_bytes,total_bytes))
+print('  Fast paths: %s'%(' '.join(fast_paths) if len(fast_paths) else '(none)'))
+print('  About %.0f cycles to look up and load each glyph'%cycles)
+report_header = '%-8s %6s %6s %6s %6s %6s %6s %7s  %s'%('profile','blocks',
+  'glyphs','tables','glyphs','fast','total','cycles','fast paths')
+report_line   = '%-8s %6d %6d %6d %6d %6d %6d %7.0f  %s'%(build_profile,
+  len(profile_rows),len(reordered),block_bytes,group_bytes,fast_path_bytes,
+  total_bytes,cycles,' '.join(fast_paths))
+report_lines = []
+if os.path.exists(profile_report_filename):
+  with open(profile_report_filename,'r') as f:
+    report_lines = [l.rstrip('\n') for l in f.readlines()[1:]]
+report_lines = [l for l in report_lines if l.split(' ')[0]!=build_profile]
+report_lines = sorted(report_lines+[report_line],
+  key=lambda l:[*build_profiles].index(l.split(' ')[0]) 
+    if l.split(' ')[0] in build_profiles else len(build_profiles))
+with open(profile_report_filename,'w') as f:
+  f.write('\n'.join([report_header]+report_lines)+'\n')
+
+#_______________________________________________________________________________
+print('\nGlyph group compression (row dictionary + row indecies):')
+print('  group glyphs width  rows index  bytes (raw→packed)  cycles/glyph (raw→packed)')
+for g,n,w,nd,k,b0,b1,c0,c1 in compression_report:
+  used = group_dictionaries[g] is not None
+  print('  %5d %6d %5d %5d %5d %7d → %-7d%s %7.0f → %.0f'%(
+    g,n,w,nd,k,b0,b1,' ' if used else '✗',c0,c1))
+print('  ✗: group stored uncompressed')
+print('  Reclaimed %d bytes, after %d bytes for group_dictionary_offsets'%(
+  max(0,reclaimed),2*len(groupinfo)))
+
 #_______________________________________________________________________________
 print('\nGlyph packing order:')
 print(reordered)
@@ -1615,9 +2036,10 @@ print('\n// Unicode points for half-width kana substitutes:'+
 # table-mapped geometricsymbols. Just need index for geometrixsymbols
 # Also assume this block is SPARSE (3)
 
-print('  // Hand-coded to fall back to mapped version of geometric shapes')
-print('  return handle_unicode_mapping_table(3, %d, c);'%\
-    [b[0] for b in blocks].index('geometricshapes'))
+if 'geometricshapes' in softmapped and 'geometricshapes' in mapped_blocks:
+  print('  // Hand-coded to fall back to mapped version of geometric shapes')
+  print('  return handle_unicode_mapping_table(3, %d, c);'%\
+      [b[0] for b in blocks].index('geometricshapes'))
 
 
 
@@ -0,0 +1,191 @@
+/*
+Find the fastest baud rate the terminal receives reliably (Linux only).
+
+    g++ -O2 -o baudprobe baudprobe.cpp
+    ./baudprobe /dev/ttyACM0 [BOOT_BAUDRATE]
+
+For each candidate rate, fastest first, this asks the Arduino to switch with
+CSI ? 901 ; <baud/100> p. The Arduino replies ACK (or NAK if it can't reach
+that rate), then both sides switch and we confirm with ENQ, which the Arduino
+answers with ACK. Without confirmation both sides drop back to the boot rate.
+
+Once switched, we send a few screenfuls of text with XON/XOFF enabled, and
+compare the error counters from CSI ? 900 n before and after. The first rate
+with no hardware overruns or dropped bytes is reported, and left in place.
+
+Arbitrary rates need the termios2 interface (BOTHER), so we include the
+kernel's termbits.h instead of termios.h.
+*/
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#define ESC "\x1b"
+#define ENQ (0x05)
+#define ACK (0x06)
+#define NAK (0x15)
+
+// How long to wait for a reply, in ms
+#define REPLY_TIMEOUT (250)
+
+// The Arduino gives up on a switch after UART_SWITCH_TIMEOUT ms (see the
+// sketch), so all our tries to confirm must fit well inside that
+#define SWITCH_TIMEOUT  (500)
+#define CONFIRM_TRIES   (4)
+#define CONFIRM_TIMEOUT (SWITCH_TIMEOUT/(CONFIRM_TRIES+1))
+
+// Rates to try, fastest first
+static const unsigned long rates[] = {
+  1000000, 500000, 250000, 230400, 115200, 57600, 38400, 19200, 9600
+};
+
+/** Set the port to raw 8N1 at the given rate, with XON/XOFF output pausing */
+static bool set_baud(int fd, unsigned long baud) {
+  struct termios2 tio;
+  if (ioctl(fd, TCGETS2, &tio)<0) return false;
+  tio.c_cflag &= ~(CBAUD|CSIZE|PARENB|CSTOPB|CRTSCTS);
+  tio.c_cflag |= BOTHER|CS8|CREAD|CLOCAL;
+  tio.c_iflag  = IXON;
+  tio.c_oflag  = 0;
+  tio.c_lflag  = 0;
+  tio.c_cc[VMIN]  = 0;
+  tio.c_cc[VTIME] = 0;
+  tio.c_ispeed = tio.c_ospeed = baud;
+  // Let queued output go at the old rate before switching
+  ioctl(fd, TCSBRK, 1);
+  if (ioctl(fd, TCSETS2, &tio)<0) return false;
+  ioctl(fd, TCFLSH, TCIFLUSH);
+  return true;
+}
+
+/** Write all of a buffer, waiting while the terminal has paused us */
+static bool send(int fd, const std::string &s) {
+  size_t done = 0;
+  while (done<s.size()) {
+    ssize_t n = write(fd, s.data()+done, s.size()-done);
+    if (n<0) return false;
+    done += n;
+  }
+  return true;
+}
+
+/** Read one byte, or -1 on timeout */
+static int read_byte(int fd, int timeout_ms) {
+  struct pollfd p = {fd, POLLIN, 0};
+  if (poll(&p, 1, timeout_ms)<=0) return -1;
+  unsigned char c;
+  return read(fd, &c, 1)==1? c : -1;
+}
+
+/** Wait for a specific control byte, skipping anything else */
+static int wait_for(int fd, int a, int b, int timeout_ms) {
+  while (1) {
+    int c = read_byte(fd, timeout_ms);
+    if (c<0 || c==a || c==b) return c;
+  }
+}
+
+/** Ask the terminal to switch rate, and switch with it.
+ *  Returns false (with both sides back at boot_baud) on failure.
+ */
+static bool switch_baud(int fd, unsigned long baud, unsigned long boot_baud) {
+  ioctl(fd, TCFLSH, TCIFLUSH);
+  send(fd, ESC "[?901;" + std::to_string(baud/100) + "p");
+  int reply = wait_for(fd, ACK, NAK, REPLY_TIMEOUT);
+  if (reply==NAK) return false;
+  if (reply!=ACK) {
+    // The ACK may have been lost; wait for the Arduino to time out
+    usleep((SWITCH_TIMEOUT+100)*1000);
+    return false;
+  }
+  set_baud(fd, baud);
+  // Give the Arduino time to finish sending ACK and switch
+  usleep(2000);
+  for (int tries=0; tries<CONFIRM_TRIES; tries++) {
+    send(fd, std::string(1, ENQ));
+    if (wait_for(fd, ACK, -1, CONFIRM_TIMEOUT)==ACK) return true;
+  }
+  set_baud(fd, boot_baud);
+  // Make sure the Arduino has timed out too
+  usleep((SWITCH_TIMEOUT+100)*1000);
+  return false;
+}
+
+/** Query CSI ? 900 n, returning overruns+dropped, or -1 on no reply */
+static long error_count(int fd) {
+  ioctl(fd, TCFLSH, TCIFLUSH);
+  send(fd, ESC "[?900n");
+  std::string reply;
+  while (1) {
+    int c = read_byte(fd, 2000);
+    if (c<0) return -1;
+    reply += (char)c;
+    if (c=='n') break;
+  }
+  unsigned long overruns, dropped, peak;
+  size_t start = reply.rfind(ESC "[?900;");
+  if (start==std::string::npos) return -1;
+  if (sscanf(reply.c_str()+start, ESC "[?900;%lu;%lu;%lun",
+    &overruns, &dropped, &peak)!=3) return -1;
+  return overruns+dropped;
+}
+
+/** Send a few screenfuls of text; scrolling is what stresses the receiver */
+static bool stress(int fd) {
+  std::string text;
+  for (int line=0; line<100; line++) {
+    for (int i=0; i<52; i++) text += (char)('!'+(line+i)%94);
+    text += "\r\n";
+  }
+  return send(fd, text);
+}
+
+int main(int argc, char **argv) {
+  if (argc<2) {
+    fprintf(stderr, "usage: %s PORT [BOOT_BAUDRATE]\n", argv[0]);
+    return 1;
+  }
+  unsigned long boot_baud = argc>2? strtoul(argv[2], 0, 10) : 57600;
+  int fd = open(argv[1], O_RDWR|O_NOCTTY);
+  if (fd<0 || !set_baud(fd, boot_baud)) {
+    perror(argv[1]);
+    return 1;
+  }
+  long base = error_count(fd);
+  if (base<0) {
+    fprintf(stderr, "No reply to CSI ? 900 n at %lu baud\n", boot_baud);
+    return 1;
+  }
+  for (unsigned long baud : rates) {
+    if (baud<=boot_baud) break;
+    printf("%8lu baud: ", baud);
+    fflush(stdout);
+    if (!switch_baud(fd, baud, boot_baud)) {
+      printf("no handshake\n");
+      continue;
+    }
+    stress(fd);
+    long errors = error_count(fd);
+    if (errors==base) {
+      printf("ok\n");
+      printf("Terminal left at %lu baud\n", baud);
+      return 0;
+    }
+    if (errors<0) printf("no status reply\n");
+    else          printf("%ld bytes lost\n", errors-base);
+    if (errors>=0) base = errors;
+    // Go back to the boot rate before trying the next one
+    if (!switch_baud(fd, boot_baud, boot_baud)) {
+      fprintf(stderr, "Lost contact at %lu baud, reset the Arduino\n", baud);
+      return 1;
+    }
+  }
+  printf("Terminal left at %lu baud\n", boot_baud);
+  return 0;
+}
@@ -0,0 +1,249 @@
+/*
+Translate utf-8 text into the terminal's glyph word mode.
+
+    g++ -O2 -o glyphencode glyphencode.cpp
+    ./glyphencode [SKETCH_DIR] < input.txt > /dev/ttyACM0
+
+The terminal looks every character up in its unicode tables: a search over
+the blocks, then (for sparse blocks) over the codepoints mapped in the block,
+to find a packed glyph word (a base glyph and a transform). In glyph word mode
+(CSI ? 903 h, see parser.h) the host sends the words instead, and they go
+straight to handle_transform.
+
+We read the same tables from the sketch's generated fontmap.h and
+glyphcodes.h (SKETCH_DIR defaults to ../Uno9341TTYv16), so the sketch must
+have been built from the same files. Output is still utf-8:
+
+  - ASCII, controls and escape sequences are passed through unchanged
+  - A character with a glyph word w in the tables is sent as U+00A0+w
+  - Anything else (soft fonts, combining marks) is sent as its codepoint
+    plus 0x10000, and the terminal looks it up as usual. So are words that
+    would land on a surrogate (U+D800-U+DFFF) or past U+FFFF. Codepoints
+    past U+FFFFF can't be sent this way, and are an error.
+
+The output starts with CSI ? 903 h and ends with CSI ? 903 l. A summary is
+printed to stderr.
+*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <vector>
+
+#define ESC (0x1b)
+#define ESC_STR "\x1b"
+#define BEL (0x07)
+
+// Block types in blockcodes (fontmap.h)
+#define DENSE  (2)
+#define SPARSE (3)
+
+// Values of the #defines in glyphcodes.h (T_ and G_ names), unevaluated
+static std::map<std::string,std::string> defines;
+
+// Transform bits of a glyph word, and the one that selects the extended page
+#define COMMAND_MASK (65024)
+static unsigned extended_page;
+
+// Tables from fontmap.h
+static std::vector<unsigned> block_starts_x16, block_lengths_x16, blockcodes,
+  first_offsets, last_offsets, sparse_nmapped, sparse_offsets,
+  sparse_indecies, bstart_indecies, codepoint_map;
+
+static std::string read_file(const std::string &path) {
+  std::ifstream f(path);
+  if (!f) {fprintf(stderr,"Can't read %s\n",path.c_str()); exit(1);}
+  std::stringstream s;
+  s << f.rdbuf();
+  return s.str();
+}
+
+/** Evaluate an entry like G_LESS|T_H5, (117|T_EP2), or 42 */
+static unsigned evaluate(const std::string &expr) {
+  unsigned value = 0;
+  std::string term;
+  for (size_t i=0; i<=expr.size(); i++) {
+    char c = i<expr.size()? expr[i] : '|';
+    if (c=='(' || c==')' || c==' ' || c=='\t' || c=='\n') continue;
+    if (c!='|') {term += c; continue;}
+    if (term.empty()) continue;
+    if (isdigit((unsigned char)term[0])) value |= strtoul(term.c_str(),0,0);
+    else if (defines.count(term)) value |= evaluate(defines[term]);
+    else {fprintf(stderr,"Unknown name %s\n",term.c_str()); exit(1);}
+    term.clear();
+  }
+  return value;
+}
+
+/** Read the #defines from glyphcodes.h */
+static void read_defines(const std::string &path) {
+  std::istringstream lines(read_file(path));
+  std::string line;
+  while (std::getline(lines,line)) {
+    line = line.substr(0,line.find("//"));
+    std::istringstream words(line);
+    std::string directive, name, value, rest;
+    if (!(words >> directive >> name) || directive!="#define") continue;
+    std::getline(words,value);
+    defines[name] = value;
+  }
+}
+
+/** Read the initializer of the array called name from fontmap.h */
+static std::vector<unsigned> read_array(const std::string &source,
+                                        const std::string &name) {
+  size_t start = source.find(" "+name+"[] PROGMEM = {");
+  if (start==std::string::npos) {
+    fprintf(stderr,"No table %s in fontmap.h\n",name.c_str());
+    exit(1);
+  }
+  start = source.find('{',start)+1;
+  size_t end = source.find("};",start);
+  std::vector<unsigned> values;
+  std::string item;
+  for (size_t i=start; i<=end; i++) {
+    // Skip comments
+    if (source.compare(i,2,"//")==0) {i = source.find('\n',i); continue;}
+    if (i<end && source[i]!=',') {item += source[i]; continue;}
+    if (item.find_first_not_of(" \t\n")!=std::string::npos)
+      values.push_back(evaluate(item));
+    item.clear();
+  }
+  return values;
+}
+
+/** The glyph word for a codepoint, as load_unicode would find it in the
+ *  mapping tables, or 0 if it isn't there */
+static unsigned glyph_word(uint32_t code) {
+  uint32_t coderow = code>>4;
+  for (size_t b=0; b<block_starts_x16.size(); b++) {
+    if (coderow<block_starts_x16[b]
+    ||  coderow>=block_starts_x16[b]+block_lengths_x16[b]) continue;
+    unsigned type = blockcodes[b]&0b11;
+    unsigned i    = blockcodes[b]>>2;
+    if (type!=DENSE && type!=SPARSE) return 0;
+    // The terminal keeps the offset into the block in a byte
+    uint8_t c = code - block_starts_x16[b]*16;
+    if (c<first_offsets[i] || c>last_offsets[i]) return 0;
+    unsigned found = c-first_offsets[i];
+    if (type==SPARSE) {
+      unsigned s = sparse_offsets[i], n = sparse_nmapped[i];
+      for (found=0; found<n && sparse_indecies[s+found]!=c; found++);
+      if (found==n) return 0;
+    }
+    unsigned w = codepoint_map[bstart_indecies[i]+found];
+    // Base glyph 0 means nothing is drawn, except on the extended page,
+    // where it is glyph 512 (see handle_transform)
+    return ((w&511) || (w&COMMAND_MASK)==extended_page)? w : 0;
+  }
+  return 0;
+}
+
+static void put_utf8(uint32_t c, std::string &out) {
+  if (c<0x80) out += (char)c;
+  else if (c<0x800) {
+    out += (char)(0xC0|(c>>6));
+    out += (char)(0x80|(c&0x3F));
+  } else if (c<0x10000) {
+    out += (char)(0xE0|(c>>12));
+    out += (char)(0x80|((c>>6)&0x3F));
+    out += (char)(0x80|(c&0x3F));
+  } else {
+    out += (char)(0xF0|(c>>18));
+    out += (char)(0x80|((c>>12)&0x3F));
+    out += (char)(0x80|((c>>6)&0x3F));
+    out += (char)(0x80|(c&0x3F));
+  }
+}
+
+/** Length of the escape sequence starting at s[i] (an ESC), or of what's
+ *  left of s if it doesn't end */
+static size_t escape_length(const std::string &s, size_t i) {
+  size_t j = i+1;
+  if (j>=s.size()) return j-i;
+  char c = s[j++];
+  if (c=='[') {
+    // CSI: parameter and intermediate bytes up to a final byte
+    while (j<s.size() && !(0x40<=s[j] && s[j]<=0x7E)) j++;
+    return std::min(j+1,s.size())-i;
+  }
+  if (c==']' || c=='P' || c=='X' || c=='^' || c=='_') {
+    // Strings end with BEL or ST (ESC \)
+    for (; j<s.size(); j++) {
+      if (s[j]==BEL) return j+1-i;
+      if (s[j]==ESC && j+1<s.size() && s[j+1]=='\\') return j+2-i;
+    }
+    return j-i;
+  }
+  // nF escapes: intermediate bytes, then a final byte
+  while (j<s.size() && 0x20<=s[j-1] && s[j-1]<=0x2F) j++;
+  return j-i;
+}
+
+int main(int argc, char **argv) {
+  std::string sketch = argc>1? argv[1] : "../Uno9341TTYv16";
+  read_defines(sketch+"/glyphcodes.h");
+  extended_page = evaluate("T_EP2");
+  std::string source = read_file(sketch+"/fontmap.h");
+  block_starts_x16  = read_array(source,"block_starts_x16");
+  block_lengths_x16 = read_array(source,"block_lengths_x16");
+  blockcodes        = read_array(source,"blockcodes");
+  first_offsets     = read_array(source,"first_offsets");
+  last_offsets      = read_array(source,"last_offsets");
+  sparse_nmapped    = read_array(source,"sparse_nmapped");
+  sparse_offsets    = read_array(source,"sparse_offsets");
+  sparse_indecies   = read_array(source,"sparse_indecies");
+  bstart_indecies   = read_array(source,"bstart_indecies");
+  codepoint_map     = read_array(source,"codepoint_map");
+
+  std::stringstream input;
+  input << std::cin.rdbuf();
+  std::string in = input.str(), out = ESC_STR "[?903h";
+  unsigned long words = 0, literals = 0, out_of_range = 0;
+  for (size_t i=0; i<in.size();) {
+    unsigned char b = in[i];
+    if (b==ESC) {
+      size_t n = escape_length(in,i);
+      out.append(in,i,n);
+      i += n;
+      continue;
+    }
+    // Decode one utf-8 character; pass anything malformed through
+    size_t n = b<0x80? 1 : b>=0xF0? 4 : b>=0xE0? 3 : b>=0xC0? 2 : 0;
+    uint32_t code = n==1? b : b&(0x3F>>(n-1));
+    for (size_t k=1; k<n; k++) {
+      if (i+k>=in.size() || ((unsigned char)in[i+k]&0xC0)!=0x80) {n=0; break;}
+      code = (code<<6)|((unsigned char)in[i+k]&0x3F);
+    }
+    if (!n) {out += in[i++]; continue;}
+    i += n;
+    // ASCII and C1 controls are the same in both modes
+    if (code<0xA0) {put_utf8(code,out); continue;}
+    // Words must encode as a single utf-8 character in the BMP, and not a
+    // surrogate; anything else goes as a literal
+    unsigned w = glyph_word(code);
+    if (w && (0xA0+w>0xFFFF || (0xD800<=0xA0+w && 0xA0+w<=0xDFFF))) {
+      w = 0;
+      out_of_range++;
+    }
+    if (w) {put_utf8(0xA0+w,out); words++;}
+    else if (0x10000+code<=0x10FFFF) {put_utf8(0x10000+code,out); literals++;}
+    else {
+      fprintf(stderr,"U+%X can't be sent in glyph word mode\n",code);
+      return 1;
+    }
+  }
+  out += ESC_STR "[?903l";
+  fwrite(out.data(),1,out.size(),stdout);
+  fprintf(stderr,"%lu glyph words, %lu other characters, %zu bytes in, "
+    "%zu bytes out\n", words, literals, in.size(), out.size());
+  if (out_of_range) fprintf(stderr,"%lu glyph words were out of range, and "
+    "were sent as other characters\n", out_of_range);
+  return 0;
+}
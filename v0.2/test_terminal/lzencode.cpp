@@ -0,0 +1,280 @@
+/*
+Compress text for the terminal's compressed input mode (LZ_INPUT, uart.h).
+
+    g++ -O2 -o lzencode lzencode.cpp
+    ./lzencode [-w WINDOW] < input.txt > /dev/ttyACM0
+    ./lzencode [-w WINDOW] -t /dev/ttyACM0 [BAUDRATE] < recording.txt
+
+The terminal decodes utf-8 as bytes arrive, into 16-bit tokens (one per
+character, or a surrogate pair past U+FFFF), and keeps the last WINDOW tokens
+it has read. We send CSI ? 904 h, then the text as utf-8, but with repeats
+replaced by 0xFF length distance: copy length tokens from distance+1 tokens
+back. 0xFF 0x00 ends compressed input. A copy costs three bytes whatever it
+holds, so escape sequences, indentation and log prefixes shrink the most.
+WINDOW must match LZ_WINDOW in the sketch (128 by default).
+
+Invalid utf-8 is sent as U+FFFD, since the terminal's tokens for it depend on
+what follows. ESC % @ and ESC % G (which switch between utf-8 and ISO-8859-1)
+are always sent as they are, never copied, as the terminal looks for them in
+the bytes it receives.
+
+With -t, the recording is sent to the terminal twice, plain and compressed,
+and each is timed until the terminal answers a status query (CSI ? 900 n)
+sent after it. This gives characters per second with and without
+compression, which includes the time spent drawing and decompressing. For
+comparison we also print the rate the wire alone would allow. The port is set
+to BAUDRATE (default 57600) with XON/XOFF, as in baudprobe.cpp.
+*/
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define ESC    (0x1b)
+#define LZ_MARK (0xFF)
+#define LZ_BEGIN "\x1b[?904h"
+
+// Longest and shortest copies, in tokens
+#define MAX_COPY (255)
+#define MIN_COPY (2)
+
+// Bytes for a copy
+#define COPY_BYTES (3)
+
+// How long to wait for the terminal to finish, in ms
+#define REPLY_TIMEOUT (60000)
+
+// A character of input: its tokens, as the terminal will see them, and the
+// bytes we send for it
+struct Character {
+  uint16_t    tokens[2];
+  int         ntokens;
+  std::string bytes;
+  bool        literal; // Part of ESC % x, never copied
+};
+
+static void put_utf8(uint32_t c, std::string &out) {
+  if (c<0x80) out += (char)c;
+  else if (c<0x800) {
+    out += (char)(0xC0|(c>>6));
+    out += (char)(0x80|(c&0x3F));
+  } else if (c<0x10000) {
+    out += (char)(0xE0|(c>>12));
+    out += (char)(0x80|((c>>6)&0x3F));
+    out += (char)(0x80|(c&0x3F));
+  } else {
+    out += (char)(0xF0|(c>>18));
+    out += (char)(0x80|((c>>12)&0x3F));
+    out += (char)(0x80|((c>>6)&0x3F));
+    out += (char)(0x80|(c&0x3F));
+  }
+}
+
+/** Split input into characters, decoding utf-8 as uart_decode does */
+static std::vector<Character> tokenize(const std::string &in) {
+  std::vector<Character> chars;
+  bool latin1 = false;
+  for (size_t i=0; i<in.size();) {
+    unsigned char b = in[i];
+    Character ch = {{0,0},1,"",false};
+    uint32_t code = b;
+    size_t n = 1;
+    if (!latin1 && b>=0xA0) {
+      // Multi-byte utf-8; anything the terminal would flag becomes U+FFFD
+      n = (b>=0xC2 && b<0xE0)? 2 : (b>=0xE0 && b<0xF0)? 3
+        : (b>=0xF0 && b<0xF5)? 4 : 0;
+      code = n? b&(0x7F>>n) : 0;
+      for (size_t k=1; k<n; k++) {
+        if (i+k>=in.size() || ((unsigned char)in[i+k]&0xC0)!=0x80) {n=0; break;}
+        code = (code<<6)|((unsigned char)in[i+k]&0x3F);
+      }
+      if ((n==3 && code<0x800) || (code>=0xD800 && code<=0xDFFF)
+      ||  (n==4 && (code<0x10000 || code>0x10FFFF))) n = 0;
+      if (!n) {code = 0xFFFD; n = 1;}
+      else if (code>=0x10000) {
+        ch.tokens[0] = 0xD800|((code-0x10000)>>10);
+        ch.tokens[1] = 0xDC00|((code-0x10000)&0x3FF);
+        ch.ntokens   = 2;
+      }
+    }
+    if (ch.ntokens==1) ch.tokens[0] = code;
+    if (latin1 && b==LZ_MARK) ch.bytes = "\xff\x01";
+    else if (latin1 || b<0xA0) ch.bytes = (char)b;
+    else put_utf8(code,ch.bytes);
+    // ESC % @ and ESC % G switch decoding after the final byte
+    size_t m = chars.size();
+    if (m>=2 && chars[m-2].tokens[0]==ESC && chars[m-1].tokens[0]=='%') {
+      chars[m-2].literal = chars[m-1].literal = ch.literal = true;
+      if (code=='@') latin1 = true;
+      if (code=='G') latin1 = false;
+    }
+    chars.push_back(ch);
+    i += n;
+  }
+  return chars;
+}
+
+struct Stats {
+  size_t copies = 0, copied = 0, literal_bytes = 0;
+};
+
+/** Compress, greedily taking the copy that saves the most bytes */
+static std::string compress(const std::vector<Character> &chars,
+                            unsigned window, Stats &stats) {
+  // Flatten to tokens, noting where each character starts
+  std::vector<uint16_t> tokens;
+  std::vector<size_t>   first; // Index of each character's first token
+  for (const Character &ch : chars) {
+    first.push_back(tokens.size());
+    for (int k=0; k<ch.ntokens; k++) tokens.push_back(ch.tokens[k]);
+  }
+  first.push_back(tokens.size());
+  std::string out = LZ_BEGIN;
+  for (size_t c=0; c<chars.size();) {
+    // Find the copy that saves the most bytes, over whole characters
+    size_t best_chars = 0, best_tokens = 0, best_distance = 0;
+    long   best_saved = 0;
+    size_t t0 = first[c];
+    for (size_t d=1; d<=window && d<=t0; d++) {
+      long   bytes = 0;
+      size_t n = 0, k = c;
+      while (k<chars.size() && !chars[k].literal) {
+        size_t nt = first[k+1]-t0;
+        if (nt>MAX_COPY) break;
+        bool same = true;
+        for (; n<nt; n++) if (tokens[t0+n]!=tokens[t0+n-d]) {same=false; break;}
+        if (!same) break;
+        bytes += chars[k].bytes.size();
+        k++;
+        if (nt>=MIN_COPY && bytes-COPY_BYTES>best_saved) {
+          best_saved    = bytes-COPY_BYTES;
+          best_chars    = k-c;
+          best_tokens   = nt;
+          best_distance = d;
+        }
+      }
+    }
+    if (best_chars) {
+      out += (char)LZ_MARK;
+      out += (char)best_tokens;
+      out += (char)(best_distance-1);
+      stats.copies++;
+      stats.copied += best_tokens;
+      c += best_chars;
+    } else {
+      out += chars[c].bytes;
+      stats.literal_bytes += chars[c].bytes.size();
+      c++;
+    }
+  }
+  out += (char)LZ_MARK;
+  out += (char)0;
+  return out;
+}
+
+/** Set the port to raw 8N1 at the given rate, with XON/XOFF output pausing */
+static bool set_baud(int fd, unsigned long baud) {
+  struct termios2 tio;
+  if (ioctl(fd, TCGETS2, &tio)<0) return false;
+  tio.c_cflag &= ~(CBAUD|CSIZE|PARENB|CSTOPB|CRTSCTS);
+  tio.c_cflag |= BOTHER|CS8|CREAD|CLOCAL;
+  tio.c_iflag  = IXON;
+  tio.c_oflag  = 0;
+  tio.c_lflag  = 0;
+  tio.c_cc[VMIN]  = 0;
+  tio.c_cc[VTIME] = 0;
+  tio.c_ispeed = tio.c_ospeed = baud;
+  if (ioctl(fd, TCSETS2, &tio)<0) return false;
+  ioctl(fd, TCFLSH, TCIFLUSH);
+  return true;
+}
+
+/** Write all of a buffer, waiting while the terminal has paused us */
+static bool send(int fd, const std::string &s) {
+  size_t done = 0;
+  while (done<s.size()) {
+    ssize_t n = write(fd, s.data()+done, s.size()-done);
+    if (n<0) return false;
+    done += n;
+  }
+  return true;
+}
+
+/** Send s, then a status query, and time until the reply ends. Returns the
+ *  time in seconds, or a negative number on failure.
+ */
+static double timed_send(int fd, const std::string &s) {
+  auto start = std::chrono::steady_clock::now();
+  if (!send(fd, s+"\x1b[?900n")) return -1;
+  while (1) {
+    struct pollfd p = {fd, POLLIN, 0};
+    if (poll(&p, 1, REPLY_TIMEOUT)<=0) return -1;
+    unsigned char c;
+    if (read(fd, &c, 1)==1 && c=='n') break;
+  }
+  std::chrono::duration<double> t = std::chrono::steady_clock::now()-start;
+  return t.count();
+}
+
+int main(int argc, char **argv) {
+  unsigned      window = 128;
+  const char   *port   = 0;
+  unsigned long baud   = 57600;
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i],"-w") && i+1<argc) window = atoi(argv[++i]);
+    else if (!strcmp(argv[i],"-t") && i+1<argc) {
+      port = argv[++i];
+      if (i+1<argc && argv[i+1][0]!='-') baud = atol(argv[++i]);
+    }
+    else {
+      fprintf(stderr,"Usage: %s [-w WINDOW] [-t PORT [BAUDRATE]]\n",argv[0]);
+      return 1;
+    }
+  }
+  if (window<1 || window>256) {
+    fprintf(stderr,"WINDOW must be 1-256\n");
+    return 1;
+  }
+
+  std::stringstream input;
+  input << std::cin.rdbuf();
+  std::string in = input.str();
+  std::vector<Character> chars = tokenize(in);
+  Stats stats;
+  std::string out = compress(chars, window, stats);
+  fprintf(stderr,"%zu characters, %zu bytes in, %zu bytes out (%.1f%%)\n",
+    chars.size(), in.size(), out.size(), 100.0*out.size()/in.size());
+  fprintf(stderr,"%zu copies of %zu tokens, %zu literal bytes\n",
+    stats.copies, stats.copied, stats.literal_bytes);
+  if (!port) {
+    fwrite(out.data(),1,out.size(),stdout);
+    return 0;
+  }
+
+  int fd = open(port, O_RDWR|O_NOCTTY);
+  if (fd<0 || !set_baud(fd, baud)) {perror(port); return 1;}
+  // 10 bits on the wire per byte
+  double wire = baud/10.0;
+  printf("%-12s %10s %10s %12s %12s\n",
+    "input","bytes","seconds","chars/s","wire chars/s");
+  const std::string *runs[] = {&in, &out};
+  const char *names[] = {"plain","compressed"};
+  for (int r=0; r<2; r++) {
+    double t = timed_send(fd, *runs[r]);
+    if (t<0) {fprintf(stderr,"No reply from the terminal\n"); return 1;}
+    printf("%-12s %10zu %10.2f %12.0f %12.0f\n", names[r], runs[r]->size(),
+      t, chars.size()/t, wire*chars.size()/runs[r]->size());
+  }
+  close(fd);
+  return 0;
+}